@@ -2,8 +2,21 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
+#include <stdarg.h>
+#include <time.h>
 
 // Headers as needed
+#include <unistd.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <arpa/inet.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
 
 typedef enum {false, true} bool;        // Allows boolean types in C
 
@@ -15,7 +28,7 @@ typedef struct Process {
     uint32_t M;                         // M: Multiplier of CPU burst time
     uint32_t processID;                 // The process ID given upon input read
 
-    uint8_t status;                     // 0 is unstarted, 1 is ready, 2 is running, 3 is blocked, 4 is terminated
+    uint8_t status;                     // 0 is unstarted, 1 is ready, 2 is running, 3 is blocked, 4 is terminated, 5 is ready suspended
 
     int32_t finishingTime;              // The cycle when the the process finishes (initially -1)
     uint32_t currentCPUTimeRun;         // The amount of time the process has already run (time in running state)
@@ -26,13 +39,40 @@ typedef struct Process {
     uint32_t CPUBurst;                  // The CPU availability of the process (has to be > 1 to move to running)
 
     int32_t quantum;                    // Used for schedulers that utilise pre-emption
-    int32_t orginialA;
     int32_t orginialC;
     bool isFirstTimeRunning;            // Used to check when to calculate the CPU burst when it hits running mode
     bool finished;
     struct Process* nextInBlockedList;  // A pointer to the next process available in the blocked list
     struct Process* nextInReadyQueue;   // A pointer to the next process available in the ready queue
     struct Process* nextInReadySuspendedQueue; // A pointer to the next process available in the ready suspended queue
+
+    uint64_t randomStreamKey;           // Key of this process' independent counter-based random stream
+    uint64_t randomCounter;             // Counter of the next random number block to generate for this process
+    uint32_t randomBatch[8];            // Random numbers generated ahead of time in one batch (recorded CPU bursts in replay mode)
+    uint32_t randomBatchNext;           // Index of the next unused random number in randomBatch
+    uint32_t replayIOBatch[8];          // The recorded IO bursts following the CPU bursts in randomBatch (replay mode only)
+    uint32_t replayQueueHead;           // Replay mode: randomBatch and replayIOBatch are a queue of recorded bursts starting here
+    uint32_t replayQueued;              // The number of recorded bursts in the queue (replay mode only)
+    bool replayBehind;                  // The process fell behind the shared replay reader and reads its own recorded bursts
+    uint32_t replayLap;                 // How many times the process started over from its first recorded burst (when behind)
+    long replayOffset;                  // Where in the replay file the process reads its next recorded burst from (when behind)
+    uint32_t replayIOBurst;             // The recorded IO burst that follows the current CPU burst (replay mode only)
+
+    uint32_t tickets;                   // Share of the CPU under proportional share policies (tickets=N in the input, 100 by default)
+    uint64_t stride;                    // Stride scheduling: how far pass advances per cycle run (STRIDE_ONE / tickets)
+    uint64_t pass;                      // Stride scheduling: the virtual time of the process, the lowest pass runs next
+    uint32_t contendedCPUTime;          // CPU time received before any process terminated (all of them still competing)
+    uint32_t deadline;                  // Cycles after its arrival the process has to be finished by (deadline=N in the input, 0 is none)
+    int32_t nice;                       // CFS: nice level from -20 to 19 (nice=N in the input, 0 by default)
+    uint32_t weight;                    // CFS: weight derived from the nice level
+    uint64_t vruntime;                  // CFS: CPU time run scaled by the weight (1024 per cycle at nice 0), the lowest runs next
+    uint32_t timeslice;                 // CFS: cycles the process may run before it can be pre-empted
+    uint32_t memory;                    // Memory footprint of the process (memory=N in the input, 0 by default)
+    bool swappedOut;                    // The process isn't in memory (it's ready suspended, or blocked and swapped out)
+    uint32_t currentSuspendedTime;      // The amount of time spent ready suspended (also counted as waiting time)
+
+    uint8_t traceStatus;                // The status of the span currently open in the timeline export
+    uint32_t traceSince;                // The cycle the open timeline span started at
 } _process;
 
 
@@ -41,55 +81,361 @@ uint32_t TOTAL_CREATED_PROCESSES = 0;   // The total number of processes constru
 uint32_t TOTAL_STARTED_PROCESSES = 0;   // The total number of processes that have started being simulated
 uint32_t TOTAL_FINISHED_PROCESSES = 0;  // The total number of processes that have finished running
 uint32_t TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0; // The total cycles in the blocked state
+bool PRINT_CYCLES = true;               // Print the state of every process each cycle (--quiet turns it off)
+bool SHOW_CPU_SHARE = false;            // Print the achieved vs target CPU share of each process (proportional share policies)
+bool SHOW_SUSPENDED_TIME = false;       // Print the ready suspended time of each process (memory model)
 
-const char* RANDOM_NUMBER_FILE_NAME= "random-numbers.txt";
+const char* RANDOM_NUMBER_FILE_NAME= "random-numbers";
 const uint32_t SEED_VALUE = 200;  // Seed value for reading from file
 
 // Additional variables as needed
 
+#define MAX_PROCESSES 100               // The most processes an input can have
+#define MAX_TICKETS (1 << 20)           // The most tickets a process can have (its stride must stay at least 1)
+
+#define RANDOM_BATCH_SIZE 8             // How many random numbers a process stream generates at once (matches randomBatch)
+
+typedef enum {RANDOM_MODE_FILE, RANDOM_MODE_COUNTER, RANDOM_MODE_REPLAY} _random_mode;
+_random_mode RANDOM_MODE = RANDOM_MODE_FILE; // file reproduces the original randomOS sequence, counter never runs out, replay uses recorded bursts
+uint64_t RANDOM_COUNTER_SEED = SEED_VALUE;  // Seed of the counter-based generator (--seed=N)
+
+uint32_t *RANDOM_NUMBER_TABLE = NULL;   // The random-numbers file, read once into memory
+uint32_t RANDOM_NUMBER_TABLE_SIZE = 0;  // The number of lines in RANDOM_NUMBER_TABLE
+
+FILE *REPLAY_FILE = NULL;               // The recorded bursts (process,cpu_burst,io_burst lines) in replay mode
+
+/* Where the recorded bursts of a process are in the replay file */
+typedef struct ReplayIndex {
+    uint32_t lines;                     // The number of recorded bursts of the process
+    long first;                         // The offset of its first and of its last line
+    long last;
+} _replay_index;
+
+_replay_index REPLAY_INDEX[MAX_PROCESSES];  // Built by one pass over the replay file when it's opened
+_process *REPLAY_PROCESSES[MAX_PROCESSES];  // The process of every processID in the policy being simulated
+long REPLAY_FILE_POSITION = 0;          // Where REPLAY_FILE currently is, so reading on doesn't need a seek
+long REPLAY_SHARED_OFFSET = 0;          // The shared reader: where the next line is read from
+uint32_t REPLAY_SHARED_LAP = 0;         // And how many times it went through the file
+
 
 /**
- * Reads a random non-negative integer X from a file with a given line named random-numbers (in the current directory)
+ * Reads every line of the random-numbers file into RANDOM_NUMBER_TABLE so bursts no longer re-read the file
+ * Returns 0 on success and 1 if the file could not be read
  */
-uint32_t getRandNumFromFile(uint32_t line, FILE* random_num_file_ptr){
-    uint32_t end, loop;
+int loadRandomNumberTable(FILE* random_num_file_ptr)
+{
+    uint32_t capacity = 1024;
     char str[512];
 
-    rewind(random_num_file_ptr); // reset to be beginning
-    for(end = loop = 0;loop<line;++loop){
-        if(0==fgets(str, sizeof(str), random_num_file_ptr)){ //include '\n'
-            end = 1;  //can't input (EOF)
-            break;
+    RANDOM_NUMBER_TABLE_SIZE = 0;
+    RANDOM_NUMBER_TABLE = malloc(capacity * sizeof(uint32_t));
+    if(RANDOM_NUMBER_TABLE == NULL)
+    {
+        return 1;
+    }
+    while(fgets(str, sizeof(str), random_num_file_ptr) != NULL)
+    {
+        if(RANDOM_NUMBER_TABLE_SIZE == capacity) // grow the table when it's full
+        {
+            uint32_t *grown = realloc(RANDOM_NUMBER_TABLE, 2 * capacity * sizeof(uint32_t));
+            if(grown == NULL)
+            {
+                free(RANDOM_NUMBER_TABLE);
+                RANDOM_NUMBER_TABLE = NULL;
+                return 1;
+            }
+            RANDOM_NUMBER_TABLE = grown;
+            capacity *= 2;
         }
+        RANDOM_NUMBER_TABLE[RANDOM_NUMBER_TABLE_SIZE++] = (uint32_t) atoi(str);
     }
-    if(!end) {
-        return (uint32_t) atoi(str);
+    return 0;
+}
+
+/**
+ * Returns the random non-negative integer X on a given line (starting at 1) of the random-numbers table
+ */
+uint32_t getRandNumFromTable(uint32_t line)
+{
+    if(line >= 1 && line <= RANDOM_NUMBER_TABLE_SIZE)
+    {
+        return RANDOM_NUMBER_TABLE[line - 1];
     }
 
-    // fail-safe return
+    // fail-safe return (same as reading past the end of the file)
     return (uint32_t) 1804289383;
 }
 
 
 
 /**
- * Reads a random non-negative integer X from a file named random-numbers.
+ * Reads a random non-negative integer X from the random-numbers table.
  * Returns the CPU Burst: : 1 + (random-number-from-file % upper_bound)
  */
-uint32_t randomOS(uint32_t upper_bound, uint32_t process_indx, FILE* random_num_file_ptr)
+uint32_t randomOS(uint32_t upper_bound, uint32_t process_indx)
 {
-    char str[20];
-    
-    uint32_t unsigned_rand_int = (uint32_t) getRandNumFromFile(SEED_VALUE+process_indx, random_num_file_ptr);
+    uint32_t unsigned_rand_int = getRandNumFromTable(SEED_VALUE+process_indx);
     uint32_t returnValue = 1 + (unsigned_rand_int % upper_bound);
 
     return returnValue;
 } 
 
+/**
+ * SplitMix64 finaliser, turns a counter value into a well mixed random 64 bit value
+ */
+static inline uint64_t counterRandomMix(uint64_t z)
+{
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Fills out with count random non-negative integers of the stream stream_key, starting at first_counter.
+ * Every value only depends on (stream, counter), so a batch is generated in one go without any state between values.
+ */
+void counterRandomBatch(uint64_t stream_key, uint64_t first_counter, uint32_t count, uint32_t *out)
+{
+    uint32_t k = 0;
+    for (; k < count; ++k)
+    {
+        out[k] = (uint32_t) (counterRandomMix(stream_key + (first_counter + k) * 0x9E3779B97F4A7C15ULL) >> 33); // 31 bits like the file
+    }
+}
+
+/**
+ * Resets the random stream of a process so every policy sees the same bursts
+ */
+void resetRandomStream(_process* process)
+{
+    process->randomStreamKey = counterRandomMix(RANDOM_COUNTER_SEED ^ counterRandomMix(process->processID + 1));
+    process->randomCounter = 0;
+    process->randomBatchNext = RANDOM_BATCH_SIZE; // empty, the first burst generates a batch
+    process->replayQueueHead = 0;
+    process->replayQueued = 0;
+    process->replayBehind = false;
+    process->replayIOBurst = 1;
+}
+
+/**
+ * Resets the random streams of every process (and the shared replay reader) before a policy is simulated
+ */
+void resetRandomStreams(_process process_list[])
+{
+    uint32_t i = 0;
+    REPLAY_SHARED_OFFSET = 0;
+    REPLAY_SHARED_LAP = 0;
+    memset(REPLAY_PROCESSES, 0, sizeof(REPLAY_PROCESSES));
+    for(; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        resetRandomStream(&process_list[i]);
+        REPLAY_PROCESSES[process_list[i].processID] = &process_list[i];
+    }
+}
+
+/**
+ * Reads the next process,cpu_burst,io_burst line at or after offset, skipping the others (header, bad lines).
+ * row_offset is set to where that line starts and offset to where the one after it starts. Returns false at the end of the file.
+ */
+bool replayReadRow(long *offset, long *row_offset, uint32_t *process_id, uint32_t *cpu_burst, uint32_t *io_burst)
+{
+    char line[256];
+    if(REPLAY_FILE_POSITION != *offset)
+    {
+        fseek(REPLAY_FILE, *offset, SEEK_SET);
+        REPLAY_FILE_POSITION = *offset;
+    }
+    while(fgets(line, sizeof(line), REPLAY_FILE) != NULL)
+    {
+        *row_offset = REPLAY_FILE_POSITION;
+        REPLAY_FILE_POSITION += strlen(line);
+        *offset = REPLAY_FILE_POSITION;
+        if(sscanf(line, "%u,%u,%u", process_id, cpu_burst, io_burst) == 3 && *process_id < MAX_PROCESSES)
+        {
+            return true;
+        }
+    }
+    clearerr(REPLAY_FILE);
+    return false;
+}
+
+/**
+ * Reads the replay file once to find the lines of every process. Returns 0 on success and 1 if it could not be read
+ */
+int replayIndexFile()
+{
+    long offset = 0;
+    long row_offset;
+    uint32_t process_id, cpu_burst, io_burst;
+    memset(REPLAY_INDEX, 0, sizeof(REPLAY_INDEX));
+    while(replayReadRow(&offset, &row_offset, &process_id, &cpu_burst, &io_burst))
+    {
+        if(REPLAY_INDEX[process_id].lines++ == 0)
+        {
+            REPLAY_INDEX[process_id].first = row_offset;
+        }
+        REPLAY_INDEX[process_id].last = row_offset;
+    }
+    return ferror(REPLAY_FILE) != 0;
+}
+
+/**
+ * Adds a recorded burst at the end of the queue of a process
+ */
+static inline void replayQueue(_process *process, uint32_t cpu_burst, uint32_t io_burst)
+{
+    uint32_t slot = (process->replayQueueHead + process->replayQueued++) % RANDOM_BATCH_SIZE;
+    process->randomBatch[slot] = cpu_burst > 0 ? cpu_burst : 1;
+    process->replayIOBatch[slot] = io_burst > 0 ? io_burst : 1;
+}
+
+/**
+ * Moves a position (lap, offset) in the file forward to the next line of a process, so two positions can be compared
+ */
+static inline void replayNextLine(const _replay_index *index, uint32_t *lap, long *offset)
+{
+    if(*offset > index->last) // no more lines of the process in this lap, the next one is its first
+    {
+        (*lap)++;
+        *offset = index->first;
+    }
+    else if(*offset < index->first)
+    {
+        *offset = index->first;
+    }
+}
+
+/**
+ * A process that fell behind the shared reader reads its own lines until its queue is full,
+ * or until it caught up with the shared reader, which then queues its lines again
+ */
+void replayReadBehind(_process *process)
+{
+    const _replay_index *index = &REPLAY_INDEX[process->processID];
+    long row_offset;
+    uint32_t process_id, cpu_burst, io_burst;
+    while(process->replayQueued < RANDOM_BATCH_SIZE)
+    {
+        uint32_t shared_lap = REPLAY_SHARED_LAP;
+        long shared_offset = REPLAY_SHARED_OFFSET;
+        replayNextLine(index, &process->replayLap, &process->replayOffset);
+        replayNextLine(index, &shared_lap, &shared_offset);
+        if(process->replayLap == shared_lap && process->replayOffset == shared_offset)
+        {
+            process->replayBehind = false;
+            return;
+        }
+        if(!replayReadRow(&process->replayOffset, &row_offset, &process_id, &cpu_burst, &io_burst))
+        {
+            process->replayOffset = index->last + 1; // the file got shorter, start over
+            continue;
+        }
+        if(process_id == process->processID)
+        {
+            replayQueue(process, cpu_burst, io_burst);
+        }
+    }
+}
+
+/**
+ * Fills the empty queue of recorded bursts of a process. One shared reader goes forward through the file and queues
+ * every line for its process, so at most RANDOM_BATCH_SIZE bursts per process are in memory. A process whose queue is
+ * full when the reader passes one of its lines falls behind, and later reads its own lines from there (replayReadBehind).
+ * At the end of the file the reader starts over, and so do the recorded bursts of every process.
+ * Processes without any recorded burst get bursts of 1.
+ */
+void replayRefill(_process* process)
+{
+    long row_offset;
+    uint32_t process_id, cpu_burst, io_burst;
+    if(REPLAY_INDEX[process->processID].lines == 0)
+    {
+        replayQueue(process, 1, 1);
+        return;
+    }
+    while(process->replayQueued == 0)
+    {
+        _process *owner;
+        if(process->replayBehind)
+        {
+            replayReadBehind(process);
+            continue;
+        }
+        if(!replayReadRow(&REPLAY_SHARED_OFFSET, &row_offset, &process_id, &cpu_burst, &io_burst))
+        {
+            REPLAY_SHARED_OFFSET = 0;
+            REPLAY_SHARED_LAP++;
+            continue;
+        }
+        owner = REPLAY_PROCESSES[process_id];
+        if(owner == NULL || owner->replayBehind) // not in the input, or it reads its own lines
+        {
+            continue;
+        }
+        if(owner->replayQueued == RANDOM_BATCH_SIZE) // its queue is full so it falls behind at this line
+        {
+            owner->replayBehind = true;
+            owner->replayLap = REPLAY_SHARED_LAP;
+            owner->replayOffset = row_offset;
+            continue;
+        }
+        replayQueue(owner, cpu_burst, io_burst);
+    }
+}
+
+/**
+ * Returns the next CPU burst of a process: 1 + (random-number % B)
+ * In file mode this is exactly randomOS, in counter mode the process' own stream is used
+ * and in replay mode it's the next recorded burst of the process
+ */
+uint32_t nextCPUBurst(_process* process)
+{
+    if(RANDOM_MODE == RANDOM_MODE_FILE)
+    {
+        return randomOS(process->B, 0);
+    }
+    if(RANDOM_MODE == RANDOM_MODE_REPLAY)
+    {
+        uint32_t cpu_burst;
+        if(process->replayQueued == 0)
+        {
+            replayRefill(process);
+        }
+        cpu_burst = process->randomBatch[process->replayQueueHead];
+        process->replayIOBurst = process->replayIOBatch[process->replayQueueHead];
+        process->replayQueueHead = (process->replayQueueHead + 1) % RANDOM_BATCH_SIZE;
+        process->replayQueued--;
+        return cpu_burst;
+    }
+    if(process->randomBatchNext == RANDOM_BATCH_SIZE) // batch used up so we generate the next one
+    {
+        counterRandomBatch(process->randomStreamKey, process->randomCounter, RANDOM_BATCH_SIZE, process->randomBatch);
+        process->randomCounter += RANDOM_BATCH_SIZE;
+        process->randomBatchNext = 0;
+    }
+    return 1 + (process->randomBatch[process->randomBatchNext++] % process->B);
+}
+
+/**
+ * Returns the IO burst that follows the current CPU burst of a process: CPUBurst * M, or the recorded one in replay mode
+ */
+uint32_t currentIOBurst(_process* process)
+{
+    if(RANDOM_MODE == RANDOM_MODE_REPLAY)
+    {
+        return process->replayIOBurst;
+    }
+    return process->CPUBurst * process->M;
+}
+
 
 /********************* SOME PRINTING HELPERS *********************/
 
 
+/* Prints part of the cycle by cycle state dump when print_cycles is set. The specialised policies pass a constant,
+ * so their --quiet versions have no dump at all */
+#define PRINT_CYCLE_STATE(print_cycles, ...) do { if(print_cycles) { printf(__VA_ARGS__); } } while(0)
+
 /**
  * Prints to standard output the original input
  * process_list is the original processes inputted (in array form)
@@ -99,11 +445,18 @@ void printStart(_process process_list[])
     printf("The original input was: %i", TOTAL_CREATED_PROCESSES);
 
     uint32_t i = 0;
+    uint32_t *input_order = malloc(TOTAL_CREATED_PROCESSES * sizeof(uint32_t)); // process_list is sorted, processID is the input position
     for (; i < TOTAL_CREATED_PROCESSES; ++i)
     {
-        printf(" ( %i %i %i %i)", process_list[i].A, process_list[i].B,
-               process_list[i].C, process_list[i].M);
+        input_order[process_list[i].processID] = i;
+    }
+    for (i = 0; i < TOTAL_CREATED_PROCESSES; ++i)
+    {
+        _process *process = &process_list[input_order[i]];
+        printf(" ( %i %i %i %i)", process->A, process->B,
+               process->C, process->M);
     }
+    free(input_order);
     printf("\n");
 } 
 
@@ -124,6 +477,47 @@ void printFinal(_process finished_process_list[])
     printf("\n");
 } // End of the print final function
 
+/**
+ * Works out the CPU share every process should have had until the first termination (while contendedCPUTime is counted)
+ * from what it's entitled to (tickets, weight): each cycle of that window is split between the processes that had arrived
+ * by then, in proportion to their entitlement. Processes arriving after the window get 0. process_list is sorted by arrival.
+ */
+void contendedTargetShares(_process process_list[], const double entitlement[], double target_share[])
+{
+    uint32_t window_end = UINT32_MAX;   // the cycle of the first termination, the last cycle of the window
+    uint32_t arrived = 0;
+    uint32_t i = 0;
+    double arrived_entitlement = 0.0;
+    double window_cycles = 0.0;
+    for (; i < TOTAL_CREATED_PROCESSES; ++i)
+    {
+        target_share[i] = 0.0;
+        if((uint32_t) process_list[i].finishingTime < window_end)
+        {
+            window_end = (uint32_t) process_list[i].finishingTime;
+        }
+    }
+    while(arrived < TOTAL_CREATED_PROCESSES && process_list[arrived].A < window_end) // one stretch of cycles per arrival time
+    {
+        uint32_t from = process_list[arrived].A + 1; // a process arriving in cycle A can run from cycle A + 1 on
+        uint32_t to;
+        while(arrived < TOTAL_CREATED_PROCESSES && process_list[arrived].A + 1 == from)
+        {
+            arrived_entitlement += entitlement[arrived++];
+        }
+        to = arrived < TOTAL_CREATED_PROCESSES && process_list[arrived].A < window_end ? process_list[arrived].A + 1 : window_end + 1;
+        for (i = 0; i < arrived; ++i)
+        {
+            target_share[i] += (to - from) * entitlement[i] / arrived_entitlement;
+        }
+        window_cycles += to - from;
+    }
+    for (i = 0; i < TOTAL_CREATED_PROCESSES && window_cycles > 0; ++i)
+    {
+        target_share[i] /= window_cycles;
+    }
+}
+
 /**
  * Prints out specifics for each process.
  * @param process_list The original processes inputted, in array form
@@ -131,6 +525,19 @@ void printFinal(_process finished_process_list[])
 void printProcessSpecifics(_process process_list[])
 {
     uint32_t i = 0;
+    double total_cpu_time = 0.0;
+    double tickets[MAX_PROCESSES];
+    double target_share[MAX_PROCESSES];
+    for (; i < TOTAL_CREATED_PROCESSES; ++i)
+    {
+        total_cpu_time += process_list[i].contendedCPUTime;
+        tickets[i] = process_list[i].tickets;
+    }
+    if(SHOW_CPU_SHARE)
+    {
+        contendedTargetShares(process_list, tickets, target_share);
+    }
+    i = 0;
     printf("\n");
     for (; i < TOTAL_CREATED_PROCESSES; ++i)
     {
@@ -141,15 +548,24 @@ void printProcessSpecifics(_process process_list[])
         printf("\tTurnaround time: %i\n", process_list[i].finishingTime - process_list[i].A);
         printf("\tI/O time: %i\n", process_list[i].currentIOBlockedTime);
         printf("\tWaiting time: %i\n", process_list[i].currentWaitingTime);
+        if(SHOW_SUSPENDED_TIME)
+        {
+            printf("\tReady suspended time: %i\n", process_list[i].currentSuspendedTime);
+        }
+        if(SHOW_CPU_SHARE)
+        {
+            printf("\tCPU share until the first termination: achieved %6f target %6f\n",
+                   total_cpu_time > 0 ? process_list[i].contendedCPUTime / total_cpu_time : 0.0, target_share[i]);
+        }
         printf("\n");
     }
 } // End of the print process specifics function
 
 /**
- * Prints out the summary data
+ * Prints out the summary data to out
  * process_list The original processes inputted, in array form
  */
-void printSummaryData(_process process_list[])
+void printSummaryDataTo(FILE *out, _process process_list[])
 {
     uint32_t i = 0;
     double total_amount_of_time_utilizing_cpu = 0.0;
@@ -180,736 +596,3083 @@ void printSummaryData(_process process_list[])
     // Calculates the average waiting time
     double avg_waiting_time = total_amount_of_time_spent_waiting / TOTAL_CREATED_PROCESSES;
 
-    printf("Summary Data:\n");
-    printf("\tFinishing time: %i\n", CURRENT_CYCLE - 1);
-    printf("\tCPU Utilisation: %6f\n", cpu_util);
-    printf("\tI/O Utilisation: %6f\n", io_util);
-    printf("\tThroughput: %6f processes per hundred cycles\n", throughput);
-    printf("\tAverage turnaround time: %6f\n", avg_turnaround_time);
-    printf("\tAverage waiting time: %6f\n", avg_waiting_time);
+    fprintf(out, "Summary Data:\n");
+    fprintf(out, "\tFinishing time: %i\n", CURRENT_CYCLE - 1);
+    fprintf(out, "\tCPU Utilisation: %6f\n", cpu_util);
+    fprintf(out, "\tI/O Utilisation: %6f\n", io_util);
+    fprintf(out, "\tThroughput: %6f processes per hundred cycles\n", throughput);
+    fprintf(out, "\tAverage turnaround time: %6f\n", avg_turnaround_time);
+    fprintf(out, "\tAverage waiting time: %6f\n", avg_waiting_time);
 } // End of the print summary data function
 
-int readProcessesFromFile(FILE *input_file, _process *process_list) 
+/**
+ * Prints out the summary data
+ * process_list The original processes inputted, in array form
+ */
+void printSummaryData(_process process_list[])
 {
+    printSummaryDataTo(stdout, process_list);
+}
 
-    if (fscanf(input_file, "%d", &TOTAL_CREATED_PROCESSES) != 1) // we fscanf the first number which is the total processes
+/********************* TIMELINE EXPORT (CHROME TRACE / PERFETTO JSON) *********************/
+
+
+#define TRACE_BUFFER_SIZE 65536         // The trace writer never holds more than this many bytes in memory
+
+/* Streams one span per process state interval to a Chrome trace JSON file (1 cycle = 1 microsecond) */
+typedef struct TraceWriter {
+    FILE *file;                         // The JSON file being written
+    char buffer[TRACE_BUFFER_SIZE];     // Events waiting to be written to the file
+    size_t used;                        // The number of bytes used in buffer
+    bool firstEvent;                    // Used to put commas between events
+    uint32_t policyID;                  // The trace "pid" of the policy currently simulated
+} _trace_writer;
+
+_trace_writer *TRACE = NULL;            // NULL unless --trace=FILE is given
+
+/**
+ * Writes the buffered events to the trace file
+ */
+void traceFlush()
+{
+    fwrite(TRACE->buffer, 1, TRACE->used, TRACE->file);
+    TRACE->used = 0;
+}
+
+/**
+ * Appends one JSON event (without the separating comma) to the trace buffer, flushing it when it's nearly full
+ */
+void traceEvent(const char *format, ...)
+{
+    va_list args;
+    int length;
+    if(TRACE_BUFFER_SIZE - TRACE->used < 512) // no event is longer than this
     {
-        fprintf(stderr, "Error reading number of processes\n");
-        fclose(input_file);
+        traceFlush();
+    }
+    if(!TRACE->firstEvent)
+    {
+        TRACE->buffer[TRACE->used++] = ',';
+        TRACE->buffer[TRACE->used++] = '\n';
+    }
+    TRACE->firstEvent = false;
+    va_start(args, format);
+    length = vsnprintf(TRACE->buffer + TRACE->used, TRACE_BUFFER_SIZE - TRACE->used, format, args);
+    va_end(args);
+    if(length > 0)
+    {
+        TRACE->used += (size_t) length < TRACE_BUFFER_SIZE - TRACE->used ? (size_t) length : TRACE_BUFFER_SIZE - TRACE->used - 1;
+    }
+}
+
+/**
+ * Opens the trace file, returns 0 on success and 1 on failure
+ */
+int traceOpen(const char *trace_file_path)
+{
+    TRACE = malloc(sizeof(_trace_writer));
+    if(TRACE == NULL)
+    {
+        return 1;
+    }
+    TRACE->file = fopen(trace_file_path, "w");
+    if(TRACE->file == NULL)
+    {
+        free(TRACE);
+        TRACE = NULL;
         return 1;
     }
+    TRACE->used = 0;
+    TRACE->firstEvent = true;
+    TRACE->policyID = 0;
+    fputs("[\n", TRACE->file);
+    return 0;
+}
 
-    for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) // for how many processes we have we fscanf the rest of the number and assign them
+/**
+ * Writes the remaining events, ends the JSON array and closes the trace file
+ */
+void traceClose()
+{
+    if(TRACE == NULL)
     {
-        fscanf(input_file, " (%d %d %d %d)", &process_list[i].A, &process_list[i].B, &process_list[i].C, &process_list[i].M);
-        process_list[i].orginialA = process_list[i].A;
-        process_list[i].orginialC = process_list[i].C;
-        process_list[i].processID = i;
+        return;
     }
+    traceFlush();
+    fputs("\n]\n", TRACE->file);
+    fclose(TRACE->file);
+    free(TRACE);
+    TRACE = NULL;
+}
 
-    fclose(input_file);
-    return 0;
+/**
+ * Starts the timeline of a policy: names it and every process in it, and forgets the spans of the previous policy
+ */
+void traceBeginPolicy(const char *policy_name, _process process_list[])
+{
+    uint32_t i = 0;
+    if(TRACE == NULL)
+    {
+        return;
+    }
+    TRACE->policyID++;
+    traceEvent("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%u,\"args\":{\"name\":\"%s\"}}", TRACE->policyID, policy_name);
+    for (; i < TOTAL_CREATED_PROCESSES; ++i)
+    {
+        traceEvent("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":\"Process %u\"}}",
+                   TRACE->policyID, process_list[i].processID, process_list[i].processID);
+        process_list[i].traceStatus = 0;
+        process_list[i].traceSince = 0;
+    }
 }
 
-void simulateFCFS(_process* process_list, FILE* random_num_file_ptr) 
+/**
+ * Writes the span of a process that was in traceStatus from traceSince up to (not including) cycle
+ * Only running, ready, blocked and ready suspended spans are written
+ */
+void traceSpan(_process *process, uint32_t cycle)
 {
-    int i = 0;
-    TOTAL_FINISHED_PROCESSES = 0;
-    TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;
-    CURRENT_CYCLE = 0;
-    int j = 0;
-    int check = 0;
-    int runner = 0;
-    int runner2 = 0;
-    printf("######################### START OF First Come First Serve #########################\n");
-    printStart(process_list); // print the beginning of process list
-    while(j < TOTAL_CREATED_PROCESSES) // loop through all process and set all the values to their base value
+    static const char *status_names[] = {"unstarted", "ready", "running", "blocked", "terminated", "ready suspended"};
+    if(process->traceStatus == 0 || process->traceStatus == 4 || cycle == process->traceSince)
     {
-        process_list[j].status = 0;
-        process_list[j].finishingTime = 0;
-        process_list[j].currentCPUTimeRun = 0;
-        process_list[j].currentIOBlockedTime = 0;
-        process_list[j].currentWaitingTime = 0;
-        process_list[j].CPUBurst = randomOS(process_list[j].B,0,random_num_file_ptr);
-        process_list[j].IOBurst = process_list[j].CPUBurst * process_list[j].M;
-        process_list[j].nextInBlockedList = NULL;
-        process_list[j].nextInReadyQueue = NULL;
-        process_list[j].nextInReadySuspendedQueue = NULL;
-        process_list[j].finished = false;
-        j++;
+        return;
     }
-    j = 0; // reset j back to 0
-    while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) // we loop for all processes till all of them are finished
+    traceEvent("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%u,\"tid\":%u,\"ts\":%u,\"dur\":%u}",
+               status_names[process->traceStatus], TRACE->policyID, process->processID,
+               process->traceSince, cycle - process->traceSince);
+}
+
+/**
+ * Records the status of a process during the current cycle, writing a span only when the status changes
+ */
+void traceObserve(_process *process, uint8_t status)
+{
+    if(TRACE == NULL || status == process->traceStatus)
     {
-        printf(" Before cycle: %d",CURRENT_CYCLE);
-        while(i < TOTAL_CREATED_PROCESSES) // we loop through all the processes in the process list every cycle
-        {
-            if(j < TOTAL_CREATED_PROCESSES)
-            {
-                if(process_list[j].status == 0) // if status is 0 we know its unstarted
-                {
-                    printf(" unstarted ");
-                }
-                else if(process_list[j].status == 1) // if status is 1 we know its ready and we increment that process waiting time
-                {
-                    printf(" ready ");
-                    process_list[j].currentWaitingTime++;
-                }
-                else if(process_list[j].status == 2) // if status is 2 we know its running and we increment that process CPUTimeRun and we -- from the CPU burst and the original C
-                {
-                    printf(" running ");
-                    process_list[i].currentCPUTimeRun++;
-                    process_list[i].orginialC--;
-                    process_list[j].CPUBurst--;
-                }
-                else if(process_list[j].status == 3) // if status is 3 we know its blocked and we increment that process blocked time and -- the IO burst
-                {
-                    printf(" blocked ");
-                    process_list[j].currentIOBlockedTime++;
-                    process_list[j].IOBurst--;
+        return;
+    }
+    traceSpan(process, CURRENT_CYCLE);
+    process->traceStatus = status;
+    process->traceSince = CURRENT_CYCLE;
+}
 
-                }
-                else if(process_list[j].status == 4) // if status is 4 we know its terminated
-                {
-                    printf(" terminated ");
-                }
-                printf(" %d ",process_list[j].status);
-                j++;
-            }
-            if(process_list[i].orginialA == 0) // check if the arrival time hits 0 and we can make it ready or running
-            {
-                if(CURRENT_CYCLE == 0) // the first cycle 
-                {
-                    if(process_list[i].orginialA == 0)
-                    {
-                        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // we loop for all the processes
-                        {
-                            if(process_list[k].status == 2) // if a running process is found we make the i value process in the ready status
-                            {
-                                process_list[i].status = 1;
-                                if(runner == 0) // if this is the first process to be ready then we just put it in the ready queue
-                                {
-                                    process_list[i].nextInReadyQueue = &process_list[i]; 
-                                }
-                                runner = 1; // make runner 1 to keep a vlue telling us that a process is running
-                                check = 1; // check is used to make it a runner or not
-                            }
-                        }
-                        if(check == 0) // if there was no runners then we make it a run
-                        {
-                            process_list[i].status = 2;
-                        }
-                    }
-                }
-                else if(process_list[i].status == 0) // if the process is unstarted we make it ready and place it into ready queue
-                {
-                    process_list[i].status = 1;
-                    process_list[i].nextInReadyQueue = &process_list[i];
-                }
-                else if(process_list[i].status == 2 && process_list[i].CPUBurst == 0) // if process is running and CPU burst is 0 then we go to block status and generate a new CPU burst
-                {
-                    process_list[i].status = 3;
-                    process_list[i].CPUBurst = randomOS(process_list[i].B,0,random_num_file_ptr);
-                    if(process_list[i].orginialC == 0)
-                    {
+/**
+ * Ends the timeline of a policy by writing the spans still open
+ */
+void traceEndPolicy(_process process_list[])
+{
+    uint32_t i = 0;
+    if(TRACE == NULL)
+    {
+        return;
+    }
+    for (; i < TOTAL_CREATED_PROCESSES; ++i)
+    {
+        traceSpan(&process_list[i], CURRENT_CYCLE);
+    }
+}
 
-                    }
-                    else
-                    {
-                        process_list[i].nextInReadySuspendedQueue = &process_list[i];
-                    }
-                }
-                else if(process_list[i].nextInReadyQueue != NULL) // we the process is in ready queue
-                {
-                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check if theres process running
-                    {
-                        if(process_list[k].status == 2)
-                        {
-                            runner = 1;
-                        }
-                    }
-                    if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status == 2 && process_list[i].IOBurst == 0)
-                    { // if we are at the first process and the last process is running and its IO burst is 0 then we make the first process running
-                        process_list[i].status = 2;
-                        process_list[i].IOBurst = process_list[i].CPUBurst * process_list[i].M; // generate a new IO burst
-                        runner = 1;
-                        process_list[i].nextInReadyQueue = NULL;
-                    }
-                    else if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status != 2) // checks to make sure its not the else statement
-                    {
 
-                    }
-                    else if(runner == 1)
-                    {
+/********************* PER TICK STATE UPDATE KERNEL *********************/
 
-                    }
-                    else
-                    {
-                        process_list[i].status = 2;
-                        process_list[i].IOBurst = process_list[i].CPUBurst * process_list[i].M;
-                        runner = 1;
-                        process_list[i].nextInReadyQueue = NULL;
-                    }
-                }
-                else if(runner == 1 && process_list[i].status == 1) // if theres a runner and the process is ready then we check if the process before is running
-                {
-                    if(process_list[i - 1].status == 2)
-                    {
-                        process_list[i].nextInReadyQueue = &process_list[i];
-                    }
-                }
-                else if(process_list[i].nextInReadySuspendedQueue != NULL && process_list[i].IOBurst == 0) // we process was in suspened queue then we make can take to the ready to be up next to run
-                {
-                    process_list[i].status = 1;
-                    process_list[i].nextInReadySuspendedQueue = NULL;
-                    process_list[i].nextInReadyQueue = &process_list[i];
-                }
-                if(process_list[i].orginialC == 0 && process_list[i].finished == false) // if the cpu completion time hits 0 and it wasn't finished already then we termiate it
-                {
-                    process_list[i].status = 4;
-                    process_list[i].finished = true;
-                    process_list[i].finishingTime = CURRENT_CYCLE;
-                    TOTAL_FINISHED_PROCESSES++;
 
-                }
+/* The per tick state of every process in contiguous arrays, so one instruction updates many processes.
+ * While a policy is simulated these are the state of the processes (the _process fields are only synced at the start and end). */
+typedef struct TickArrays {
+    uint32_t capacity;                  // Number of lanes, TOTAL_CREATED_PROCESSES rounded up to TICK_LANES
+    _process *processes;                // The process of every lane (lane i is process_list[i])
+    uint32_t *status;                   // status (padding lanes are terminated)
+    uint32_t *waitingTime;              // currentWaitingTime
+    uint32_t *ioBlockedTime;            // currentIOBlockedTime
+    uint32_t *ioBurst;                  // IOBurst
+    uint64_t *ioDoneMask;               // Bit i set when the IO burst of process i hit 0 this tick
+} _tick_arrays;
 
-            }
-            else // if arrival time isn't 0 then we -- till it's 0 because right now its unstarted
-            {
-                process_list[i].orginialA--;
-                
-            }
-            i++;
-        }
-        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check to see if theres a running process at the end
+#define TICK_LANES 8                    // Widest kernel (AVX2, 8 x 32 bit), the arrays are padded to a multiple of it
+
+/* The tick kernels */
+typedef enum {TICK_KERNEL_SCALAR, TICK_KERNEL_SSE2, TICK_KERNEL_AVX2, TOTAL_TICK_KERNELS} _tick_kernel;
+_tick_kernel TICK_KERNEL = TICK_KERNEL_SCALAR; // Chosen once at start up by selectTickKernel
+_tick_arrays TICK;                      // The per tick state of the policy being simulated
+
+/**
+ * Allocates the arrays for the processes of process_list, returns 0 on success and 1 when out of memory
+ */
+int tickArraysCreate(_tick_arrays *tick, _process process_list[])
+{
+    uint32_t mask_words;
+    tick->processes = process_list;
+    tick->capacity = (TOTAL_CREATED_PROCESSES + TICK_LANES - 1) / TICK_LANES * TICK_LANES;
+    mask_words = tick->capacity / 64 + 1;
+    tick->status = calloc(tick->capacity, sizeof(uint32_t));
+    tick->waitingTime = calloc(tick->capacity, sizeof(uint32_t));
+    tick->ioBlockedTime = calloc(tick->capacity, sizeof(uint32_t));
+    tick->ioBurst = calloc(tick->capacity, sizeof(uint32_t));
+    tick->ioDoneMask = calloc(mask_words, sizeof(uint64_t));
+    for(uint32_t k = TOTAL_CREATED_PROCESSES; k < tick->capacity && tick->status != NULL; k++)
+    {
+        tick->status[k] = 4; // padding lanes are terminated and never change
+    }
+    return tick->status == NULL || tick->waitingTime == NULL || tick->ioBlockedTime == NULL || tick->ioBurst == NULL
+        || tick->ioDoneMask == NULL;
+}
+
+void tickArraysFree(_tick_arrays *tick)
+{
+    free(tick->status);
+    free(tick->waitingTime);
+    free(tick->ioBlockedTime);
+    free(tick->ioBurst);
+    free(tick->ioDoneMask);
+}
+
+/**
+ * Returns the lane of a process
+ */
+static inline uint32_t tickLane(const _process *process)
+{
+    return (uint32_t) (process - TICK.processes);
+}
+
+/**
+ * Loads the starting state of the processes into the arrays, once before the first cycle
+ */
+void tickArraysGather(_tick_arrays *tick)
+{
+    uint32_t k = 0;
+    for (; k < TOTAL_CREATED_PROCESSES; ++k)
+    {
+        tick->status[k] = tick->processes[k].status;
+        tick->waitingTime[k] = tick->processes[k].currentWaitingTime;
+        tick->ioBlockedTime[k] = tick->processes[k].currentIOBlockedTime;
+        tick->ioBurst[k] = tick->processes[k].IOBurst;
+    }
+}
+
+/**
+ * Copies the final state back into the processes, once after the last cycle (for printing)
+ */
+void tickArraysScatter(_tick_arrays *tick)
+{
+    uint32_t k = 0;
+    for (; k < TOTAL_CREATED_PROCESSES; ++k)
+    {
+        tick->processes[k].status = tick->status[k];
+        tick->processes[k].currentWaitingTime = tick->waitingTime[k];
+        tick->processes[k].currentIOBlockedTime = tick->ioBlockedTime[k];
+        tick->processes[k].IOBurst = tick->ioBurst[k];
+    }
+}
+
+/**
+ * Returns true when bit index is set in mask
+ */
+static inline bool tickMaskTest(const uint64_t *mask, uint32_t index)
+{
+    return (mask[index / 64] >> (index % 64)) & 1;
+}
+
+/**
+ * Scalar kernel, one process at a time: ready ones wait and blocked ones do IO
+ */
+void tickKernelScalar(_tick_arrays *tick)
+{
+    uint32_t k = 0;
+    memset(tick->ioDoneMask, 0, (tick->capacity / 64 + 1) * sizeof(uint64_t));
+    for (; k < tick->capacity; ++k)
+    {
+        if(tick->status[k] == 1) // ready
         {
-            if(process_list[k].status == 2)
-            {
-                runner2 = 1;
-            }
+            tick->waitingTime[k]++;
         }
-        if(runner2 == 0) // if theres not and theres a process in the ready queue then we make that a running process
+        else if(tick->status[k] == 3) // blocked
         {
-            for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+            tick->ioBlockedTime[k]++;
+            tick->ioBurst[k]--;
+            if(tick->ioBurst[k] == 0)
             {
-                if(process_list[k].nextInReadyQueue != NULL && runner2 == 0)
-                {
-                    process_list[k].nextInReadyQueue = NULL;
-                    process_list[k].status = 2;
-                    process_list[k].IOBurst = process_list[k].CPUBurst * process_list[k].M;
-                    runner2 = 1;
-                }
+                tick->ioDoneMask[k / 64] |= (uint64_t) 1 << (k % 64);
             }
         }
-        i = 0;
-        printf("\n");
-        j = 0;
-        CURRENT_CYCLE++; // increment cycle at the end
-        runner = 0; // and reset the variables for the next cycle
-        runner2 = 0;
     }
-    for(int i = 0; i < TOTAL_FINISHED_PROCESSES; i++) // we also add the blocked time to number of cycles spent blocked
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+/**
+ * SSE2 kernel, 4 processes per instruction. Compare masks are all ones (-1) so subtracting them counts up and adding them counts down
+ */
+__attribute__((target("sse2")))
+void tickKernelSSE2(_tick_arrays *tick)
+{
+    const __m128i ready = _mm_set1_epi32(1);
+    const __m128i blocked = _mm_set1_epi32(3);
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t k = 0;
+    memset(tick->ioDoneMask, 0, (tick->capacity / 64 + 1) * sizeof(uint64_t));
+    for (; k < tick->capacity; k += 4)
     {
-        TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED += process_list[i].currentIOBlockedTime;
+        __m128i status = _mm_loadu_si128((const __m128i *) &tick->status[k]);
+        __m128i is_ready = _mm_cmpeq_epi32(status, ready);
+        __m128i is_blocked = _mm_cmpeq_epi32(status, blocked);
+        __m128i waiting = _mm_sub_epi32(_mm_loadu_si128((const __m128i *) &tick->waitingTime[k]), is_ready);
+        __m128i io_blocked = _mm_sub_epi32(_mm_loadu_si128((const __m128i *) &tick->ioBlockedTime[k]), is_blocked);
+        __m128i io_burst = _mm_add_epi32(_mm_loadu_si128((const __m128i *) &tick->ioBurst[k]), is_blocked);
+        __m128i io_done = _mm_and_si128(is_blocked, _mm_cmpeq_epi32(io_burst, zero));
+        _mm_storeu_si128((__m128i *) &tick->waitingTime[k], waiting);
+        _mm_storeu_si128((__m128i *) &tick->ioBlockedTime[k], io_blocked);
+        _mm_storeu_si128((__m128i *) &tick->ioBurst[k], io_burst);
+        tick->ioDoneMask[k / 64] |= (uint64_t) _mm_movemask_ps(_mm_castsi128_ps(io_done)) << (k % 64);
     }
-    printProcessSpecifics(process_list); // print final specifics and summary
-    printSummaryData(process_list);
-    printFinal(process_list);
-    printf("######################### END OF First Come First Serve #########################\n");
-    return;
 }
 
-void simulateRR(_process* process_list, FILE* random_num_file_ptr) 
+/**
+ * AVX2 kernel, same as the SSE2 one with 8 processes per instruction
+ */
+__attribute__((target("avx2")))
+void tickKernelAVX2(_tick_arrays *tick)
 {
-    int i = 0;
-    TOTAL_FINISHED_PROCESSES = 0;
-    TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;
-    CURRENT_CYCLE = 0;
-    int j = 0;
-    int check = 0;
-    int runner = 0;
-    int runner2 = 0;
-    printf("######################### START OF ROUND ROBIN #########################\n");
-    printStart(process_list); // print the beginning of process list
-    while(j < TOTAL_CREATED_PROCESSES) // loop through all process and set all the values to their base value
+    const __m256i ready = _mm256_set1_epi32(1);
+    const __m256i blocked = _mm256_set1_epi32(3);
+    const __m256i zero = _mm256_setzero_si256();
+    uint32_t k = 0;
+    memset(tick->ioDoneMask, 0, (tick->capacity / 64 + 1) * sizeof(uint64_t));
+    for (; k < tick->capacity; k += 8)
     {
-        process_list[j].status = 0;
-        process_list[j].finishingTime = 0;
-        process_list[j].currentCPUTimeRun = 0;
-        process_list[j].currentIOBlockedTime = 0;
-        process_list[j].currentWaitingTime = 0;
-        process_list[j].quantum = 2;
-        process_list[j].orginialC = process_list[j].C;
-        process_list[j].orginialA = process_list[j].A;
-        process_list[j].CPUBurst = randomOS(process_list[j].B,0,random_num_file_ptr);
-        process_list[j].IOBurst = process_list[j].CPUBurst * process_list[j].M;
-        process_list[j].nextInBlockedList = NULL;
-        process_list[j].nextInReadyQueue = NULL;
-        process_list[j].nextInReadySuspendedQueue = NULL;
-        process_list[j].finished = false;
-        j++;
+        __m256i status = _mm256_loadu_si256((const __m256i *) &tick->status[k]);
+        __m256i is_ready = _mm256_cmpeq_epi32(status, ready);
+        __m256i is_blocked = _mm256_cmpeq_epi32(status, blocked);
+        __m256i waiting = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *) &tick->waitingTime[k]), is_ready);
+        __m256i io_blocked = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i *) &tick->ioBlockedTime[k]), is_blocked);
+        __m256i io_burst = _mm256_add_epi32(_mm256_loadu_si256((const __m256i *) &tick->ioBurst[k]), is_blocked);
+        __m256i io_done = _mm256_and_si256(is_blocked, _mm256_cmpeq_epi32(io_burst, zero));
+        _mm256_storeu_si256((__m256i *) &tick->waitingTime[k], waiting);
+        _mm256_storeu_si256((__m256i *) &tick->ioBlockedTime[k], io_blocked);
+        _mm256_storeu_si256((__m256i *) &tick->ioBurst[k], io_burst);
+        tick->ioDoneMask[k / 64] |= (uint64_t) _mm256_movemask_ps(_mm256_castsi256_ps(io_done)) << (k % 64);
     }
-    j = 0; // reset j back to 0
-    while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) // we loop for all processes till all of them are finished
+}
+#endif
+
+/**
+ * Picks the widest kernel the CPU supports
+ */
+void selectTickKernel()
+{
+    TICK_KERNEL = TICK_KERNEL_SCALAR;
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
     {
-        printf(" Before cycle: %d",CURRENT_CYCLE);
-        while(i < TOTAL_CREATED_PROCESSES) // we loop through all the processes in the process list every cycle
-        {
-            if(j < TOTAL_CREATED_PROCESSES)
-            {
-                if(process_list[j].status == 0) // if status is 0 we know its unstarted
-                {
-                    printf(" unstarted ");
-                }
-                else if(process_list[j].status == 1) // if status is 1 we know its ready and we increment that process waiting time
-                {
-                    printf(" ready ");
-                    process_list[j].currentWaitingTime++;
-                }
-                else if(process_list[j].status == 2) // if status is 2 we know its running and we increment that process CPUTimeRun and we -- from the CPU burst and the original C
-                {
-                    printf(" running ");
-                    process_list[i].currentCPUTimeRun++;
-                    process_list[i].orginialC--;
-                    process_list[j].CPUBurst--;
-                    process_list[j].quantum--;
-                }
-                else if(process_list[j].status == 3) // if status is 3 we know its blocked and we increment that process blocked time and -- the IO burst
-                {
-                    printf(" blocked ");
-                    process_list[j].currentIOBlockedTime++;
-                    process_list[j].IOBurst--;
+        TICK_KERNEL = TICK_KERNEL_AVX2;
+    }
+    else if(__builtin_cpu_supports("sse2"))
+    {
+        TICK_KERNEL = TICK_KERNEL_SSE2;
+    }
+#endif
+}
 
-                }
-                else if(process_list[j].status == 4) // if status is 4 we know its terminated
-                {
-                    printf(" terminated ");
-                }
-                printf(" %d ",process_list[j].status);
-                j++;
+/**
+ * Runs one tick with the kernel chosen at start up. It's one well predicted branch per tick, so the policies aren't
+ * specialised per kernel
+ */
+static inline void tickKernelRun(_tick_arrays *tick, const _tick_kernel kernel)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    if(kernel == TICK_KERNEL_AVX2)
+    {
+        tickKernelAVX2(tick);
+        return;
+    }
+    if(kernel == TICK_KERNEL_SSE2)
+    {
+        tickKernelSSE2(tick);
+        return;
+    }
+#endif
+    tickKernelScalar(tick);
+}
+
+
+/**
+ * Reads the optional key=value fields that can follow (A B C M) inside the parentheses, e.g. (0 1 5 1 tickets=300)
+ * Returns 0 on success and 1 on an unknown or malformed field
+ */
+int parseProcessOptions(_process *process, char *options)
+{
+    char *option;
+    long long value;                    // Parsed signed, so negative values are rejected instead of wrapping around
+    process->tickets = 100;
+    process->deadline = 0;
+    process->nice = 0;
+    process->memory = 0;
+    for(option = strtok(options, " \t\r\n"); option != NULL; option = strtok(NULL, " \t\r\n"))
+    {
+        if(sscanf(option, "tickets=%lld", &value) == 1 && value >= 1 && value <= MAX_TICKETS)
+        {
+            process->tickets = (uint32_t) value;
+            continue;
+        }
+        if(sscanf(option, "deadline=%lld", &value) == 1 && value >= 0 && value <= UINT32_MAX)
+        {
+            process->deadline = (uint32_t) value;
+            continue;
+        }
+        if(sscanf(option, "nice=%d", &process->nice) == 1 && process->nice >= -20 && process->nice <= 19)
+        {
+            continue;
+        }
+        if(sscanf(option, "memory=%lld", &value) == 1 && value >= 0 && value <= UINT32_MAX)
+        {
+            process->memory = (uint32_t) value;
+            continue;
+        }
+        fprintf(stderr, "Unknown process field or value out of range: %s\n", option);
+        return 1;
+    }
+    return 0;
+}
+
+/**
+ * Orders processes by arrival time, processes arriving at the same time keep their input order
+ */
+int compareArrival(const void *a, const void *b)
+{
+    const _process *first = a;
+    const _process *second = b;
+    if(first->A != second->A)
+    {
+        return first->A < second->A ? -1 : 1;
+    }
+    return first->processID < second->processID ? -1 : first->processID > second->processID;
+}
+
+/**
+ * Admits every process whose arrival time has been reached.
+ * process_list is sorted by arrival, so only the processes arriving this cycle are looked at.
+ * Returns the new number of arrived processes (they are process_list[0 .. arrived - 1])
+ */
+uint32_t admitArrivals(_process process_list[], uint32_t arrived)
+{
+    while(arrived < TOTAL_CREATED_PROCESSES && process_list[arrived].A <= CURRENT_CYCLE)
+    {
+        arrived++;
+    }
+    return arrived;
+}
+
+int readProcessesFromFile(FILE *input_file, _process *process_list) 
+{
+
+    if (fscanf(input_file, "%d", &TOTAL_CREATED_PROCESSES) != 1) // we fscanf the first number which is the total processes
+    {
+        fprintf(stderr, "Error reading number of processes\n");
+        fclose(input_file);
+        return 1;
+    }
+    if (TOTAL_CREATED_PROCESSES > MAX_PROCESSES)
+    {
+        fprintf(stderr, "Too many processes (at most %d)\n", MAX_PROCESSES);
+        fclose(input_file);
+        return 1;
+    }
+
+    for (int i = 0; i < TOTAL_CREATED_PROCESSES; i++) // for how many processes we have we fscanf the rest of the number and assign them
+    {
+        char fields[256];
+        int used = 0;
+        if (fscanf(input_file, " (%255[^)])", fields) != 1
+            || sscanf(fields, "%u %u %u %u%n", &process_list[i].A, &process_list[i].B, &process_list[i].C, &process_list[i].M, &used) != 4
+            || parseProcessOptions(&process_list[i], fields + used))
+        {
+            fprintf(stderr, "Error reading process %d\n", i);
+            fclose(input_file);
+            return 1;
+        }
+        if (process_list[i].B == 0) // CPU bursts are 1 + (random-number % B)
+        {
+            fprintf(stderr, "Error reading process %d: B has to be at least 1\n", i);
+            fclose(input_file);
+            return 1;
+        }
+        process_list[i].orginialC = process_list[i].C;
+        process_list[i].processID = i;
+    }
+    qsort(process_list, TOTAL_CREATED_PROCESSES, sizeof(_process), compareArrival); // the schedulers go through the processes in arrival order
+
+    fclose(input_file);
+    return 0;
+}
+
+/**
+ * First Come First Serve, specialised like the shared engine (see SPECIALISED ENGINES)
+ */
+static inline __attribute__((always_inline)) void simulateFCFSCycles(_process* process_list, const bool print_cycles, const bool instrument)
+{
+    int i = 0;
+    TOTAL_FINISHED_PROCESSES = 0;
+    TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;
+    CURRENT_CYCLE = 0;
+    int j = 0;
+    int check = 0;
+    int runner = 0;
+    int runner2 = 0;
+    uint32_t arrived = 0; // the number of processes (in arrival order) that have arrived
+    if(tickArraysCreate(&TICK, process_list))
+    {
+        fprintf(stderr, "Error allocating the tick arrays\n");
+        tickArraysFree(&TICK);
+        return;
+    }
+    printf("######################### START OF First Come First Serve #########################\n");
+    printStart(process_list); // print the beginning of process list
+    if(instrument)
+    {
+        traceBeginPolicy("First Come First Serve", process_list);
+    }
+    resetRandomStreams(process_list); // every policy sees the same bursts
+    while(j < TOTAL_CREATED_PROCESSES) // loop through all process and set all the values to their base value
+    {
+        process_list[j].status = 0;
+        process_list[j].finishingTime = 0;
+        process_list[j].currentCPUTimeRun = 0;
+        process_list[j].currentIOBlockedTime = 0;
+        process_list[j].currentWaitingTime = 0;
+        process_list[j].CPUBurst = nextCPUBurst(&process_list[j]);
+        process_list[j].IOBurst = currentIOBurst(&process_list[j]);
+        process_list[j].nextInBlockedList = NULL;
+        process_list[j].nextInReadyQueue = NULL;
+        process_list[j].nextInReadySuspendedQueue = NULL;
+        process_list[j].finished = false;
+        j++;
+    }
+    j = 0; // reset j back to 0
+    tickArraysGather(&TICK); // from here on the state of the processes is kept in TICK
+    while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) // we loop for all processes till all of them are finished
+    {
+        PRINT_CYCLE_STATE(print_cycles, " Before cycle: %d", CURRENT_CYCLE);
+        arrived = admitArrivals(process_list, arrived); // only the processes arriving this cycle are looked at
+        tickKernelRun(&TICK, TICK_KERNEL); // ready and blocked bookkeeping of every process at once
+        while(j < TOTAL_CREATED_PROCESSES) // we print every process and do the bookkeeping of the running one
+        {
+            if(TICK.status[j] == 0) // if status is 0 we know its unstarted
+            {
+                PRINT_CYCLE_STATE(print_cycles, " unstarted ");
             }
-            if(process_list[i].orginialA == 0) // check if the arrival time hits 0 and we can make it ready or running
+            else if(TICK.status[j] == 1) // if status is 1 we know its ready (the tick kernel incremented its waiting time)
             {
-                if(CURRENT_CYCLE == 0) // the first cycle 
+                PRINT_CYCLE_STATE(print_cycles, " ready ");
+            }
+            else if(TICK.status[j] == 2) // if status is 2 we know its running and we increment that process CPUTimeRun and we -- from the CPU burst and the original C
+            {
+                PRINT_CYCLE_STATE(print_cycles, " running ");
+                process_list[j].currentCPUTimeRun++;
+                process_list[j].orginialC--;
+                process_list[j].CPUBurst--;
+            }
+            else if(TICK.status[j] == 3) // if status is 3 we know its blocked (the tick kernel incremented its blocked time and -- the IO burst)
+            {
+                PRINT_CYCLE_STATE(print_cycles, " blocked ");
+            }
+            else if(TICK.status[j] == 4) // if status is 4 we know its terminated
+            {
+                PRINT_CYCLE_STATE(print_cycles, " terminated ");
+            }
+            PRINT_CYCLE_STATE(print_cycles, " %d ", TICK.status[j]);
+            if(instrument)
+            {
+                traceObserve(&process_list[j], TICK.status[j]);
+            }
+            j++;
+        }
+        while(i < arrived) // we loop through all the processes that have arrived (the rest are still unstarted)
+        {
+            if(CURRENT_CYCLE == 0) // the first cycle 
+            {
+                if(process_list[i].A == 0)
                 {
-                    if(process_list[i].orginialA == 0)
+                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // we loop for all the processes
                     {
-                        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // we loop for all the processes
+                        if(TICK.status[k] == 2) // if a running process is found we make the i value process in the ready status
                         {
-                            if(process_list[k].status == 2) // if a running process is found we make the i value process in the ready status
+                            TICK.status[i] = 1;
+                            if(runner == 0) // if this is the first process to be ready then we just put it in the ready queue
                             {
-                                process_list[i].status = 1;
-                                if(runner == 0) // if this is the first process to be ready then we just put it in the ready queue
-                                {
-                                    process_list[i].nextInReadyQueue = &process_list[i];
-                                }
-                                runner = 1; // make runner 1 to keep a vlue telling us that a process is running
-                                check = 1; // check is used to make it a runner or not
+                                process_list[i].nextInReadyQueue = &process_list[i]; 
                             }
-                        }
-                        if(check == 0) // if there was no runners then we make it a run
-                        {
-                            process_list[i].status = 2;
+                            runner = 1; // make runner 1 to keep a vlue telling us that a process is running
+                            check = 1; // check is used to make it a runner or not
                         }
                     }
+                    if(check == 0) // if there was no runners then we make it a run
+                    {
+                        TICK.status[i] = 2;
+                    }
                 }
-                else if(process_list[i].status == 0) // if the process is unstarted we make it ready and place it into ready queue
+            }
+            else if(TICK.status[i] == 0) // if the process is unstarted we make it ready and place it into ready queue
+            {
+                TICK.status[i] = 1;
+                process_list[i].nextInReadyQueue = &process_list[i];
+            }
+            else if(TICK.status[i] == 2 && process_list[i].CPUBurst == 0) // if process is running and CPU burst is 0 then we go to block status and generate a new CPU burst
+            {
+                TICK.status[i] = 3;
+                process_list[i].CPUBurst = nextCPUBurst(&process_list[i]);
+                if(process_list[i].orginialC == 0)
                 {
-                    process_list[i].status = 1;
-                    process_list[i].nextInReadyQueue = &process_list[i];
+
                 }
-                else if(process_list[i].status == 2 && process_list[i].CPUBurst == 0) // if process is running and CPU burst is 0 then we go to block status and generate a new CPU burst
+                else
                 {
-                    process_list[i].status = 3;
-                    process_list[i].quantum = 2;
-                    process_list[i].CPUBurst = randomOS(process_list[i].B,0,random_num_file_ptr);
-                    if(process_list[i].orginialC == 0)
-                    {
-
-                    }
-                    else
-                    {
-                        process_list[i].nextInReadySuspendedQueue = &process_list[i];
-                    }
+                    process_list[i].nextInReadySuspendedQueue = &process_list[i];
                 }
-                else if(process_list[i].nextInReadyQueue != NULL) // we the process is in ready queue
+            }
+            else if(process_list[i].nextInReadyQueue != NULL) // we the process is in ready queue
+            {
+                for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check if theres process running
                 {
-                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check if theres process running
+                    if(TICK.status[k] == 2)
                     {
-                        if(process_list[k].status == 2)
-                        {
-                            runner = 1;
-                        }
-                    }
-                    if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status == 2 && process_list[i].IOBurst == 0)
-                    { // if we are at the first process and the last process is running and its IO burst is 0 then we make the first process running
-                        process_list[i].status = 2;
-                        process_list[i].IOBurst = process_list[i].CPUBurst * process_list[i].M; // generate a new IO burst
                         runner = 1;
-                        process_list[i].nextInReadyQueue = NULL;
                     }
-                    else if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status != 2) // checks to make sure its not the else statement
-                    {
+                }
+                if(i == 0 && TICK.status[TOTAL_CREATED_PROCESSES - 1] == 2 && TICK.ioBurst[i] == 0)
+                { // if we are at the first process and the last process is running and its IO burst is 0 then we make the first process running
+                    TICK.status[i] = 2;
+                    TICK.ioBurst[i] = currentIOBurst(&process_list[i]); // generate a new IO burst
+                    runner = 1;
+                    process_list[i].nextInReadyQueue = NULL;
+                }
+                else if(i == 0 && TICK.status[TOTAL_CREATED_PROCESSES - 1] != 2) // checks to make sure its not the else statement
+                {
 
-                    }
-                    else if(runner == 1)
-                    {
+                }
+                else if(runner == 1)
+                {
+
+                }
+                else
+                {
+                    TICK.status[i] = 2;
+                    TICK.ioBurst[i] = currentIOBurst(&process_list[i]);
+                    runner = 1;
+                    process_list[i].nextInReadyQueue = NULL;
+                }
+            }
+            else if(runner == 1 && TICK.status[i] == 1) // if theres a runner and the process is ready then we check if the process before is running
+            {
+                if(TICK.status[i - 1] == 2)
+                {
+                    process_list[i].nextInReadyQueue = &process_list[i];
+                }
+            }
+            else if(process_list[i].nextInReadySuspendedQueue != NULL && tickMaskTest(TICK.ioDoneMask, i)) // we process was in suspened queue then we make can take to the ready to be up next to run
+            {
+                TICK.status[i] = 1;
+                process_list[i].nextInReadySuspendedQueue = NULL;
+                process_list[i].nextInReadyQueue = &process_list[i];
+            }
+            if(process_list[i].orginialC == 0 && process_list[i].finished == false) // if the cpu completion time hits 0 and it wasn't finished already then we termiate it
+            {
+                TICK.status[i] = 4;
+                process_list[i].finished = true;
+                process_list[i].finishingTime = CURRENT_CYCLE;
+                TOTAL_FINISHED_PROCESSES++;
+
+            }
+
+            i++;
+        }
+        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check to see if theres a running process at the end
+        {
+            if(TICK.status[k] == 2)
+            {
+                runner2 = 1;
+            }
+        }
+        if(runner2 == 0) // if theres not and theres a process in the ready queue then we make that a running process
+        {
+            for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+            {
+                if(process_list[k].nextInReadyQueue != NULL && runner2 == 0)
+                {
+                    process_list[k].nextInReadyQueue = NULL;
+                    TICK.status[k] = 2;
+                    TICK.ioBurst[k] = currentIOBurst(&process_list[k]);
+                    runner2 = 1;
+                }
+            }
+        }
+        i = 0;
+        PRINT_CYCLE_STATE(print_cycles, "\n");
+        j = 0;
+        CURRENT_CYCLE++; // increment cycle at the end
+        runner = 0; // and reset the variables for the next cycle
+        runner2 = 0;
+    }
+    tickArraysScatter(&TICK);
+    for(int i = 0; i < TOTAL_FINISHED_PROCESSES; i++) // we also add the blocked time to number of cycles spent blocked
+    {
+        TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED += process_list[i].currentIOBlockedTime;
+    }
+    tickArraysFree(&TICK);
+    if(instrument)
+    {
+        traceEndPolicy(process_list);
+    }
+    printProcessSpecifics(process_list); // print final specifics and summary
+    printSummaryData(process_list);
+    printFinal(process_list);
+    printf("######################### END OF First Come First Serve #########################\n");
+    return;
+}
+
+/**
+ * Round Robin, specialised like the shared engine (see SPECIALISED ENGINES)
+ */
+static inline __attribute__((always_inline)) void simulateRRCycles(_process* process_list, const bool print_cycles, const bool instrument)
+{
+    int i = 0;
+    TOTAL_FINISHED_PROCESSES = 0;
+    TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;
+    CURRENT_CYCLE = 0;
+    int j = 0;
+    int check = 0;
+    int runner = 0;
+    int runner2 = 0;
+    uint32_t arrived = 0; // the number of processes (in arrival order) that have arrived
+    if(tickArraysCreate(&TICK, process_list))
+    {
+        fprintf(stderr, "Error allocating the tick arrays\n");
+        tickArraysFree(&TICK);
+        return;
+    }
+    printf("######################### START OF ROUND ROBIN #########################\n");
+    printStart(process_list); // print the beginning of process list
+    if(instrument)
+    {
+        traceBeginPolicy("Round Robin", process_list);
+    }
+    resetRandomStreams(process_list); // every policy sees the same bursts
+    while(j < TOTAL_CREATED_PROCESSES) // loop through all process and set all the values to their base value
+    {
+        process_list[j].status = 0;
+        process_list[j].finishingTime = 0;
+        process_list[j].currentCPUTimeRun = 0;
+        process_list[j].currentIOBlockedTime = 0;
+        process_list[j].currentWaitingTime = 0;
+        process_list[j].quantum = 2;
+        process_list[j].orginialC = process_list[j].C;
+        process_list[j].CPUBurst = nextCPUBurst(&process_list[j]);
+        process_list[j].IOBurst = currentIOBurst(&process_list[j]);
+        process_list[j].nextInBlockedList = NULL;
+        process_list[j].nextInReadyQueue = NULL;
+        process_list[j].nextInReadySuspendedQueue = NULL;
+        process_list[j].finished = false;
+        j++;
+    }
+    j = 0; // reset j back to 0
+    tickArraysGather(&TICK); // from here on the state of the processes is kept in TICK
+    while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) // we loop for all processes till all of them are finished
+    {
+        PRINT_CYCLE_STATE(print_cycles, " Before cycle: %d", CURRENT_CYCLE);
+        arrived = admitArrivals(process_list, arrived); // only the processes arriving this cycle are looked at
+        tickKernelRun(&TICK, TICK_KERNEL); // ready and blocked bookkeeping of every process at once
+        while(j < TOTAL_CREATED_PROCESSES) // we print every process and do the bookkeeping of the running one
+        {
+            if(TICK.status[j] == 0) // if status is 0 we know its unstarted
+            {
+                PRINT_CYCLE_STATE(print_cycles, " unstarted ");
+            }
+            else if(TICK.status[j] == 1) // if status is 1 we know its ready (the tick kernel incremented its waiting time)
+            {
+                PRINT_CYCLE_STATE(print_cycles, " ready ");
+            }
+            else if(TICK.status[j] == 2) // if status is 2 we know its running and we increment that process CPUTimeRun and we -- from the CPU burst and the original C
+            {
+                PRINT_CYCLE_STATE(print_cycles, " running ");
+                process_list[j].currentCPUTimeRun++;
+                process_list[j].orginialC--;
+                process_list[j].CPUBurst--;
+                process_list[j].quantum--;
+            }
+            else if(TICK.status[j] == 3) // if status is 3 we know its blocked (the tick kernel incremented its blocked time and -- the IO burst)
+            {
+                PRINT_CYCLE_STATE(print_cycles, " blocked ");
+            }
+            else if(TICK.status[j] == 4) // if status is 4 we know its terminated
+            {
+                PRINT_CYCLE_STATE(print_cycles, " terminated ");
+            }
+            PRINT_CYCLE_STATE(print_cycles, " %d ", TICK.status[j]);
+            if(instrument)
+            {
+                traceObserve(&process_list[j], TICK.status[j]);
+            }
+            j++;
+        }
+        while(i < arrived) // we loop through all the processes that have arrived (the rest are still unstarted)
+        {
+            if(CURRENT_CYCLE == 0) // the first cycle 
+            {
+                if(process_list[i].A == 0)
+                {
+                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // we loop for all the processes
+                    {
+                        if(TICK.status[k] == 2) // if a running process is found we make the i value process in the ready status
+                        {
+                            TICK.status[i] = 1;
+                            if(runner == 0) // if this is the first process to be ready then we just put it in the ready queue
+                            {
+                                process_list[i].nextInReadyQueue = &process_list[i];
+                            }
+                            runner = 1; // make runner 1 to keep a vlue telling us that a process is running
+                            check = 1; // check is used to make it a runner or not
+                        }
+                    }
+                    if(check == 0) // if there was no runners then we make it a run
+                    {
+                        TICK.status[i] = 2;
+                    }
+                }
+            }
+            else if(TICK.status[i] == 0) // if the process is unstarted we make it ready and place it into ready queue
+            {
+                TICK.status[i] = 1;
+                process_list[i].nextInReadyQueue = &process_list[i];
+            }
+            else if(TICK.status[i] == 2 && process_list[i].CPUBurst == 0) // if process is running and CPU burst is 0 then we go to block status and generate a new CPU burst
+            {
+                TICK.status[i] = 3;
+                process_list[i].quantum = 2;
+                process_list[i].CPUBurst = nextCPUBurst(&process_list[i]);
+                if(process_list[i].orginialC == 0)
+                {
+
+                }
+                else
+                {
+                    process_list[i].nextInReadySuspendedQueue = &process_list[i];
+                }
+            }
+            else if(process_list[i].nextInReadyQueue != NULL) // we the process is in ready queue
+            {
+                for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check if theres process running
+                {
+                    if(TICK.status[k] == 2)
+                    {
+                        runner = 1;
+                    }
+                }
+                if(i == 0 && TICK.status[TOTAL_CREATED_PROCESSES - 1] == 2 && TICK.ioBurst[i] == 0)
+                { // if we are at the first process and the last process is running and its IO burst is 0 then we make the first process running
+                    TICK.status[i] = 2;
+                    TICK.ioBurst[i] = currentIOBurst(&process_list[i]); // generate a new IO burst
+                    runner = 1;
+                    process_list[i].nextInReadyQueue = NULL;
+                }
+                else if(i == 0 && TICK.status[TOTAL_CREATED_PROCESSES - 1] != 2) // checks to make sure its not the else statement
+                {
+
+                }
+                else if(runner == 1)
+                {
+
+                }
+                else
+                {
+                    TICK.status[i] = 2;
+                    TICK.ioBurst[i] = currentIOBurst(&process_list[i]);
+                    runner = 1;
+                    process_list[i].nextInReadyQueue = NULL;
+                }
+            }
+            else if(runner == 1 && TICK.status[i] == 1) // if theres a runner and the process is ready then we check if the process before is running
+            {
+                if(TICK.status[i - 1] == 2)
+                {
+                    process_list[i].nextInReadyQueue = &process_list[i];
+                }
+            }
+            else if(process_list[i].nextInReadySuspendedQueue != NULL && tickMaskTest(TICK.ioDoneMask, i)) // when process was in suspened queue then we make can take to the ready to be up next to run
+            {
+                TICK.status[i] = 1;
+                process_list[i].nextInReadySuspendedQueue = NULL;
+                process_list[i].nextInReadyQueue = &process_list[i];
+            }
+            if(process_list[i].orginialC == 0 && process_list[i].finished == false) // if the cpu completion time hits 0 and it wasn't finished already then we termiate it
+            {
+                TICK.status[i] = 4;
+                process_list[i].finished = true;
+                process_list[i].finishingTime = CURRENT_CYCLE;
+                TOTAL_FINISHED_PROCESSES++;
+
+            }
+            if(process_list[i].quantum == 0 && process_list[i].orginialC != 0) // check if the quantum is 0 then we stop running 
+            {
+                process_list[i].quantum = 2;
+                TICK.status[i] = 1;
+                process_list[i].nextInReadyQueue = &process_list[i];
+            }
+            i++;
+        }
+        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check to see if theres a running process at the end
+        {
+            if(TICK.status[k] == 2)
+            {
+                runner2 = 1;
+            }
+        }
+        if(runner2 == 0) // if theres not and theres a process in the ready queue then we make that a running process
+        {
+            for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+            {
+                if(process_list[k].nextInReadyQueue != NULL && runner2 == 0)
+                {
+                    process_list[k].nextInReadyQueue = NULL;
+                    TICK.status[k] = 2;
+                    if(TICK.ioBurst[k] == 0)
+                    {
+                        TICK.ioBurst[k] = currentIOBurst(&process_list[k]);
+                    }
+                    runner2 = 1;
+                }
+            }
+        }
+        i = 0;
+        PRINT_CYCLE_STATE(print_cycles, "\n");
+        j = 0;
+        CURRENT_CYCLE++; // increment cycle at the end
+        runner = 0; // and reset the variables for the next cycle
+        runner2 = 0;
+    }
+    tickArraysScatter(&TICK);
+    for(int i = 0; i < TOTAL_CREATED_PROCESSES; i++) // we also add the blocked time to number of cycles spent blocked
+    {
+        TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED += process_list[i].currentIOBlockedTime;
+    }
+
+    tickArraysFree(&TICK);
+    if(instrument)
+    {
+        traceEndPolicy(process_list);
+    }
+    printProcessSpecifics(process_list); // print final specifics and summary
+    printSummaryData(process_list);
+    printFinal(process_list);
+    printf("######################### END OF ROUND ROBIN #########################\n");
+    return;
+}
+
+/**
+ * Shortest Job First, specialised like the shared engine (see SPECIALISED ENGINES)
+ */
+static inline __attribute__((always_inline)) void simulateSJFCycles(_process* process_list, const bool print_cycles, const bool instrument)
+{
+    int i = 0;
+    TOTAL_FINISHED_PROCESSES = 0;
+    TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;
+    CURRENT_CYCLE = 0;
+    int j = 0;
+    int readyCheck = 0;
+    int minRunner = 10000;
+    int saveIndex = 0;
+    int check = 0;
+    int runner = 0;
+    int runner2 = 0;
+    uint32_t arrived = 0; // the number of processes (in arrival order) that have arrived
+    printf("######################### START OF SHORTEST JOB FIRST #########################\n");
+    printStart(process_list); // print the beginning of process list
+    if(instrument)
+    {
+        traceBeginPolicy("Shortest Job First", process_list);
+    }
+    resetRandomStreams(process_list); // every policy sees the same bursts
+    while(j < TOTAL_CREATED_PROCESSES) // loop through all process and set all the values to their base value
+    {
+        process_list[j].status = 0;
+        process_list[j].finishingTime = 0;
+        process_list[j].currentCPUTimeRun = 0;
+        process_list[j].currentIOBlockedTime = 0;
+        process_list[j].currentWaitingTime = 0;
+        process_list[j].orginialC = process_list[j].C;
+        process_list[j].CPUBurst = nextCPUBurst(&process_list[j]);
+        process_list[j].IOBurst = currentIOBurst(&process_list[j]);
+        process_list[j].nextInBlockedList = NULL;
+        process_list[j].nextInReadyQueue = NULL;
+        process_list[j].nextInReadySuspendedQueue = NULL;
+        process_list[j].finished = false;
+        j++;
+    }
+    j = 0; // reset j back to 0
+    while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) // we loop for all processes till all of them are finished
+    {
+        PRINT_CYCLE_STATE(print_cycles, " Before cycle: %d", CURRENT_CYCLE);
+        arrived = admitArrivals(process_list, arrived); // only the processes arriving this cycle are looked at
+        while(i < TOTAL_CREATED_PROCESSES) // we loop through all the processes in the process list every cycle
+        {
+            if(j < TOTAL_CREATED_PROCESSES)
+            {
+                if(process_list[j].status == 0) // if status is 0 we know its unstarted
+                {
+                    PRINT_CYCLE_STATE(print_cycles, " unstarted ");
+                }
+                else if(process_list[j].status == 1) // if status is 1 we know its ready and we increment that process waiting time
+                {
+                    PRINT_CYCLE_STATE(print_cycles, " ready ");
+                    process_list[j].currentWaitingTime++;
+                }
+                else if(process_list[j].status == 2) // if status is 2 we know its running and we increment that process CPUTimeRun and we -- from the CPU burst and the original C
+                {
+                    PRINT_CYCLE_STATE(print_cycles, " running ");
+                    process_list[i].currentCPUTimeRun++;
+                    process_list[i].orginialC--;
+                    process_list[j].CPUBurst--;
+                }
+                else if(process_list[j].status == 3) // if status is 3 we know its blocked and we increment that process blocked time and -- the IO burst
+                {
+                    PRINT_CYCLE_STATE(print_cycles, " blocked ");
+                    process_list[j].currentIOBlockedTime++;
+                    process_list[j].IOBurst--;
+
+                }
+                else if(process_list[j].status == 4) // if status is 4 we know its terminated
+                {
+                    PRINT_CYCLE_STATE(print_cycles, " terminated ");
+                }
+                PRINT_CYCLE_STATE(print_cycles, " %d ", process_list[j].status);
+                if(instrument)
+                {
+                    traceObserve(&process_list[j], process_list[j].status);
+                }
+                j++;
+            }
+            if(i < arrived) // check if the process has arrived and we can make it ready or running
+            {
+                if(CURRENT_CYCLE == 0) // the first cycle 
+                {
+                    if(process_list[i].A == 0)
+                    {
+                        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // we loop for all the processes
+                        {
+                            if(process_list[k].status == 2) // if a running process is found we make the i value process in the ready status
+                            {
+                                process_list[i].status = 1;
+                                if(runner == 0) // if this is the first process to be ready then we just put it in the ready queue
+                                {
+                                    process_list[i].nextInReadyQueue = &process_list[i];
+                                }
+                                runner = 1; // make runner 1 to keep a vlue telling us that a process is running
+                                check = 1; // check is used to make it a runner or not
+                            }
+                        }
+                        if(check == 0) // if there was no runners then we make it a run
+                        {
+                            process_list[i].status = 2;
+                        }
+                    }
+                }
+                else if(process_list[i].status == 0) // if the process is unstarted we make it ready and place it into ready queue
+                {
+                    process_list[i].status = 1;
+                    process_list[i].nextInReadyQueue = &process_list[i];
+                }
+                else if(process_list[i].status == 2 && process_list[i].CPUBurst == 0) // if process is running and CPU burst is 0 then we go to block status and generate a new CPU burst
+                {
+                    process_list[i].status = 3;
+                    process_list[i].CPUBurst = nextCPUBurst(&process_list[i]);
+                    if(process_list[i].orginialC == 0)
+                    {
+
+                    }
+                    else
+                    {
+                        process_list[i].nextInReadySuspendedQueue = &process_list[i];
+                    }
+                }
+                else if(process_list[i].nextInReadyQueue != NULL && process_list[i].status != 4) // we the process is in ready queue
+                {
+                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check if theres process running
+                    {
+                        if(process_list[k].status == 2)
+                        {
+                            runner = 1;
+                        }
+                    }
+                    if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status == 2 && process_list[i].IOBurst == 0)
+                    { // if we are at the first process and the last process is running and its IO burst is 0 then we make the first process running
+                        process_list[i].status = 2;
+                        process_list[i].IOBurst = currentIOBurst(&process_list[i]); // generate a new IO burst
+                        runner = 1;
+                        process_list[i].nextInReadyQueue = NULL;
+                    }
+                    else if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status != 2) // checks to make sure its not the else statement
+                    {
+
+                    }
+                    else if(runner == 1)
+                    {
+
+                    }
+                    else if(process_list[i].status == 4)
+                    {
+
+                    }
+                    else
+                    {
+                        process_list[i].status = 2;
+                        process_list[i].IOBurst = currentIOBurst(&process_list[i]);
+                        runner = 1;
+                        process_list[i].nextInReadyQueue = NULL;
+                    }
+                }
+                else if(runner == 1 && process_list[i].status == 1 && process_list[i].status != 4) // if theres a runner and the process is ready then we check if the process before is running
+                {
+                    if(process_list[i - 1].status == 2)
+                    {
+                        process_list[i].nextInReadyQueue = &process_list[i];
+                    }
+                }
+                else if(process_list[i].nextInReadySuspendedQueue != NULL && process_list[i].IOBurst == 0 && process_list[i].status != 4) // we process was in suspened queue then we make can take to the ready to be up next to run
+                {
+                    process_list[i].status = 1;
+                    process_list[i].nextInReadySuspendedQueue = NULL;
+                    process_list[i].nextInReadyQueue = &process_list[i];
+                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+                    {
+                        if(process_list[k].status == 1)
+                        {
+                            readyCheck++;
+                        }
+                    }
+                    if(readyCheck >= 2)
+                    {
+                        minRunner = process_list[i].orginialC;
+                        saveIndex = i;
+                        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+                        {
+                            if(process_list[k].status != 4)
+                            {
+                                if(process_list[k].orginialC + 1 < minRunner)
+                                {
+                                    saveIndex = k;
+                                    minRunner = process_list[k].orginialC;
+                                }
+                            }
+                        }
+                        process_list[saveIndex].status = 2;
+                        process_list[i].IOBurst = currentIOBurst(&process_list[i]);
+                        runner = 1;
+                        process_list[i].nextInReadyQueue = NULL;
+                    }
+                }
+                if(process_list[i].orginialC == 0 && process_list[i].finished == false) // if the cpu completion time hits 0 and it wasn't finished already then we termiate it
+                {
+                    process_list[i].status = 4;
+                    process_list[i].finished = true;
+                    process_list[i].nextInReadyQueue = NULL;
+                    process_list[i].nextInReadySuspendedQueue = NULL;
+                    process_list[i].finishingTime = CURRENT_CYCLE;
+                    TOTAL_FINISHED_PROCESSES++;
+
+                }
+
+            }
+            i++;
+        }
+        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check to see if theres a running process at the end
+        {
+            if(process_list[k].status == 2)
+            {
+                runner2 = 1;
+            }
+        }
+        if(runner2 == 0) // if theres not and theres a process in the ready queue then we make that a running process
+        {
+            for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+            {
+                if(process_list[k].nextInReadyQueue != NULL && runner2 == 0)
+                {
+                    process_list[k].nextInReadyQueue = NULL;
+                    process_list[k].status = 2;
+                    process_list[k].IOBurst = currentIOBurst(&process_list[k]);
+                    runner2 = 1;
+                }
+            }
+        }
+        i = 0;
+        PRINT_CYCLE_STATE(print_cycles, "\n");
+        j = 0;
+        CURRENT_CYCLE++; // increment cycle at the end
+        runner = 0; // and reset the variables for the next cycle
+        readyCheck = 0;
+        minRunner = 0;
+        saveIndex = 0;
+        runner2 = 0;
+
+    }
+    for(int i = 0; i < TOTAL_FINISHED_PROCESSES; i++) // we also add the blocked time to number of cycles spent blocked
+    {
+        TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED += process_list[i].currentIOBlockedTime;
+    }
+    if(instrument)
+    {
+        traceEndPolicy(process_list);
+    }
+    printProcessSpecifics(process_list);  // print final specifics and summary
+    printSummaryData(process_list);
+    printFinal(process_list);
+    printf("######################### END OF SHORTEST JOB FIRST #########################\n");
+    return;
+}
+/********************* HEAP DISPATCHED POLICIES *********************/
+
+
+/* The ready processes ordered by key (lowest first, ties go to the lowest processID) */
+typedef struct ReadyHeap {
+    uint32_t size;                      // The number of ready processes in the heap
+    uint64_t keys[MAX_PROCESSES];       // The key each process was pushed with
+    _process *processes[MAX_PROCESSES]; // The ready processes, in heap order
+} _ready_heap;
+
+_ready_heap READY_HEAP;                 // The ready queue of the heap dispatched policies
+
+/**
+ * Returns true when heap entry a has to come out before heap entry b
+ */
+static inline bool heapBefore(uint32_t a, uint32_t b)
+{
+    if(READY_HEAP.keys[a] != READY_HEAP.keys[b])
+    {
+        return READY_HEAP.keys[a] < READY_HEAP.keys[b];
+    }
+    return READY_HEAP.processes[a]->processID < READY_HEAP.processes[b]->processID;
+}
+
+static inline void heapSwap(uint32_t a, uint32_t b)
+{
+    uint64_t key = READY_HEAP.keys[a];
+    _process *process = READY_HEAP.processes[a];
+    READY_HEAP.keys[a] = READY_HEAP.keys[b];
+    READY_HEAP.processes[a] = READY_HEAP.processes[b];
+    READY_HEAP.keys[b] = key;
+    READY_HEAP.processes[b] = process;
+}
+
+/**
+ * Moves entry index down until both its children come after it
+ */
+void heapSiftDown(uint32_t index)
+{
+    while(true)
+    {
+        uint32_t smallest = index;
+        uint32_t left = 2 * index + 1;
+        uint32_t right = left + 1;
+        if(left < READY_HEAP.size && heapBefore(left, smallest))
+        {
+            smallest = left;
+        }
+        if(right < READY_HEAP.size && heapBefore(right, smallest))
+        {
+            smallest = right;
+        }
+        if(smallest == index)
+        {
+            return;
+        }
+        heapSwap(index, smallest);
+        index = smallest;
+    }
+}
+
+/**
+ * Adds a ready process with the given key, O(log N)
+ */
+void heapPush(_process *process, uint64_t key)
+{
+    uint32_t index = READY_HEAP.size++;
+    READY_HEAP.keys[index] = key;
+    READY_HEAP.processes[index] = process;
+    while(index > 0 && heapBefore(index, (index - 1) / 2)) // move it up above its parents with a bigger key
+    {
+        heapSwap(index, (index - 1) / 2);
+        index = (index - 1) / 2;
+    }
+}
+
+/**
+ * Removes and returns the ready process at position index of the heap, O(log N)
+ */
+_process *heapRemoveAt(uint32_t index)
+{
+    _process *process = READY_HEAP.processes[index];
+    READY_HEAP.size--;
+    if(index < READY_HEAP.size)
+    {
+        READY_HEAP.keys[index] = READY_HEAP.keys[READY_HEAP.size];
+        READY_HEAP.processes[index] = READY_HEAP.processes[READY_HEAP.size];
+        while(index > 0 && heapBefore(index, (index - 1) / 2))
+        {
+            heapSwap(index, (index - 1) / 2);
+            index = (index - 1) / 2;
+        }
+        heapSiftDown(index);
+    }
+    return process;
+}
+
+/**
+ * Removes and returns the ready process with the lowest key, NULL when nothing is ready
+ */
+_process *heapPop()
+{
+    return READY_HEAP.size > 0 ? heapRemoveAt(0) : NULL;
+}
+
+/* What a heap dispatched policy adds to the common process lifecycle */
+typedef struct PolicyHooks {
+    const char *title;                  // Used in the START OF / END OF banners
+    const char *traceName;              // The name of the policy in the timeline export
+    void (*start)(_process process_list[]);     // Sets up the policy before the first cycle
+    void (*ready)(_process *process);           // A process became ready (arrived, finished its IO or got pre-empted, then quantum > 0)
+    _process *(*pick)();                        // Removes and returns the next process to run, NULL if nothing is ready
+    void (*ran)(_process *process);             // The running process ran for one cycle
+    bool (*preempt)(_process *process);         // Checked at the start of every cycle the process is still running
+    void (*end)(_process process_list[]);       // Prints the policy specific results after the summary data
+} _policy_hooks;
+
+/* Memory model (medium-term scheduler), only used by the heap dispatched policies */
+
+uint32_t MEMORY_CAPACITY = 0;           // RAM of the host (--memory=N), 0 is unlimited and turns the model off
+uint32_t SWAP_IN_COST = 4;              // Cycles the swap device needs to bring a process in (--swap-in-cost=N)
+uint32_t SWAP_OUT_COST = 4;             // Cycles the swap device needs to write a process out (--swap-out-cost=N)
+
+uint32_t MEMORY_FREE = 0;               // RAM not used or reserved by a resident process
+_process *READY_SUSPENDED_HEAD = NULL;  // Ready processes waiting for memory, oldest first (linked by nextInReadySuspendedQueue)
+_process *READY_SUSPENDED_TAIL = NULL;
+uint32_t READY_SUSPENDED_COUNT = 0;     // The number of processes in the ready suspended queue (including the one swapping in)
+_process *SWAPPING = NULL;              // The process the swap device is working on, NULL when it's idle
+bool SWAPPING_IN = false;               // true when SWAPPING is being swapped in, false when out
+uint32_t SWAP_BUSY = 0;                 // Cycles left of the current swap
+
+uint32_t TOTAL_SWAP_INS = 0;            // The number of processes swapped in
+uint32_t TOTAL_SWAP_OUTS = 0;           // The number of processes swapped out
+uint64_t TOTAL_SWAP_TRAFFIC = 0;        // The memory moved in and out by the swap device
+uint32_t TOTAL_STALL_CYCLES = 0;        // Cycles the CPU was idle while a process was waiting for memory
+uint64_t TOTAL_SUSPENDED_CYCLES = 0;    // Cycles spent in the ready suspended state, summed over the processes
+
+void memoryStart(_process process_list[])
+{
+    uint32_t i = 0;
+    MEMORY_FREE = MEMORY_CAPACITY;
+    SHOW_SUSPENDED_TIME = true;
+    READY_SUSPENDED_HEAD = READY_SUSPENDED_TAIL = NULL;
+    READY_SUSPENDED_COUNT = 0;
+    SWAPPING = NULL;
+    SWAP_BUSY = 0;
+    TOTAL_SWAP_INS = TOTAL_SWAP_OUTS = TOTAL_STALL_CYCLES = 0;
+    TOTAL_SWAP_TRAFFIC = TOTAL_SUSPENDED_CYCLES = 0;
+    for(; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        process_list[i].swappedOut = false;
+        process_list[i].nextInReadySuspendedQueue = NULL;
+        process_list[i].currentSuspendedTime = 0;
+    }
+}
+
+/**
+ * The memory a process needs: its footprint, but never more than the whole host so it can always run eventually
+ */
+static inline uint32_t memoryNeeded(const _process *process)
+{
+    return process->memory < MEMORY_CAPACITY ? process->memory : MEMORY_CAPACITY;
+}
+
+/**
+ * Puts a ready process that isn't in memory at the end of the ready suspended queue
+ */
+void memorySuspend(_process *process)
+{
+    TICK.status[tickLane(process)] = 5;
+    process->swappedOut = true;
+    process->nextInReadySuspendedQueue = NULL;
+    if(READY_SUSPENDED_TAIL == NULL)
+    {
+        READY_SUSPENDED_HEAD = process;
+    }
+    else
+    {
+        READY_SUSPENDED_TAIL->nextInReadySuspendedQueue = process;
+    }
+    READY_SUSPENDED_TAIL = process;
+    READY_SUSPENDED_COUNT++;
+}
+
+/**
+ * Loads an arriving process if it fits (nobody is waiting for memory before it), returns true when it's resident.
+ * Otherwise it waits in the ready suspended queue.
+ */
+bool memoryAdmit(_process *process)
+{
+    if(MEMORY_CAPACITY == 0 || (READY_SUSPENDED_HEAD == NULL && memoryNeeded(process) <= MEMORY_FREE))
+    {
+        MEMORY_FREE -= MEMORY_CAPACITY == 0 ? 0 : memoryNeeded(process);
+        return true;
+    }
+    memorySuspend(process);
+    return false;
+}
+
+/**
+ * Gives back the memory of a terminated process
+ */
+void memoryRelease(_process *process)
+{
+    if(MEMORY_CAPACITY > 0)
+    {
+        MEMORY_FREE += memoryNeeded(process);
+    }
+}
+
+/**
+ * Counts one cycle of ready suspended time for every process waiting for memory (the one swapping in included).
+ * It's waiting time too, the process is ready but for its memory. Called next to the tick kernel, which counts the ready ones.
+ */
+void memoryTick()
+{
+    _process *process = READY_SUSPENDED_HEAD;
+    if(SWAPPING != NULL && SWAPPING_IN)
+    {
+        SWAPPING->currentSuspendedTime++;
+        TICK.waitingTime[tickLane(SWAPPING)]++;
+    }
+    for(; process != NULL; process = process->nextInReadySuspendedQueue)
+    {
+        process->currentSuspendedTime++;
+        TICK.waitingTime[tickLane(process)]++;
+    }
+    TOTAL_SUSPENDED_CYCLES += READY_SUSPENDED_COUNT;
+}
+
+/**
+ * Runs the swap device for one cycle. When it's idle it swaps in the oldest ready suspended process if it fits,
+ * and otherwise swaps out the blocked process with the most IO left to make room for it.
+ * Processes that are done swapping in become ready through the policy's ready hook.
+ */
+void memoryCycle(_process process_list[], const _policy_hooks *hooks)
+{
+    if(MEMORY_CAPACITY == 0)
+    {
+        return;
+    }
+    if(SWAPPING != NULL && SWAP_BUSY > 0)
+    {
+        SWAP_BUSY--;
+    }
+    while(true)
+    {
+        if(SWAPPING != NULL && SWAP_BUSY == 0) // the current swap is done
+        {
+            if(SWAPPING_IN)
+            {
+                SWAPPING->swappedOut = false;
+                TICK.status[tickLane(SWAPPING)] = 1;
+                READY_SUSPENDED_COUNT--;
+                hooks->ready(SWAPPING);
+            }
+            else
+            {
+                MEMORY_FREE += memoryNeeded(SWAPPING);
+            }
+            SWAPPING = NULL;
+        }
+        if(SWAPPING != NULL || READY_SUSPENDED_HEAD == NULL)
+        {
+            return;
+        }
+        if(memoryNeeded(READY_SUSPENDED_HEAD) <= MEMORY_FREE) // swap in the oldest waiting process
+        {
+            SWAPPING = READY_SUSPENDED_HEAD;
+            SWAPPING_IN = true;
+            SWAP_BUSY = SWAP_IN_COST;
+            READY_SUSPENDED_HEAD = SWAPPING->nextInReadySuspendedQueue;
+            if(READY_SUSPENDED_HEAD == NULL)
+            {
+                READY_SUSPENDED_TAIL = NULL;
+            }
+            SWAPPING->nextInReadySuspendedQueue = NULL;
+            MEMORY_FREE -= memoryNeeded(SWAPPING);
+            TOTAL_SWAP_INS++;
+            TOTAL_SWAP_TRAFFIC += memoryNeeded(SWAPPING);
+        }
+        else // or make room by swapping out the blocked process that needs the CPU last
+        {
+            _process *victim = NULL;
+            for(uint32_t i = 0; i < TOTAL_CREATED_PROCESSES; i++)
+            {
+                if(TICK.status[i] == 3 && !process_list[i].swappedOut && memoryNeeded(&process_list[i]) > 0
+                   && (victim == NULL || TICK.ioBurst[i] > TICK.ioBurst[tickLane(victim)]))
+                {
+                    victim = &process_list[i];
+                }
+            }
+            if(victim == NULL) // nothing to swap out, wait for a resident process to terminate or block
+            {
+                return;
+            }
+            SWAPPING = victim;
+            SWAPPING_IN = false;
+            SWAP_BUSY = SWAP_OUT_COST;
+            victim->swappedOut = true;
+            TOTAL_SWAP_OUTS++;
+            TOTAL_SWAP_TRAFFIC += memoryNeeded(victim);
+        }
+    }
+}
+
+/**
+ * Prints the swap traffic and the cycles lost to it, next to the summary data
+ */
+void printMemoryData()
+{
+    if(MEMORY_CAPACITY == 0)
+    {
+        return;
+    }
+    printf("Memory Data:\n");
+    printf("\tSwap ins: %u\n", TOTAL_SWAP_INS);
+    printf("\tSwap outs: %u\n", TOTAL_SWAP_OUTS);
+    printf("\tSwap traffic: %llu\n", (unsigned long long) TOTAL_SWAP_TRAFFIC);
+    printf("\tStall cycles: %u\n", TOTAL_STALL_CYCLES);
+    printf("\tReady suspended time: %llu\n", (unsigned long long) TOTAL_SUSPENDED_CYCLES);
+}
+
+
+/**
+ * Simulates the common process lifecycle (unstarted, ready, running, blocked, terminated) cycle by cycle
+ * and leaves every scheduling decision to the hooks of the policy. Prints the same output as the other policies.
+ * Always inlined: called with constant hooks and options the compiler builds an engine without the unused branches
+ * (see SPECIALISED ENGINES), called with run time ones it's the generic engine.
+ */
+static inline __attribute__((always_inline)) void simulateEngine(_process* process_list, const _policy_hooks *hooks,
+                                                                 const bool print_cycles, const bool instrument, const bool memory_model)
+{
+    static const char *status_names[] = {"unstarted", "ready", "running", "blocked", "terminated", "suspended"};
+    uint32_t i = 0;
+    uint32_t arrived = 0;
+    _process *running = NULL;
+    TOTAL_FINISHED_PROCESSES = 0;
+    TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;
+    CURRENT_CYCLE = 0;
+    READY_HEAP.size = 0;
+    if(tickArraysCreate(&TICK, process_list))
+    {
+        fprintf(stderr, "Error allocating the tick arrays\n");
+        tickArraysFree(&TICK);
+        return;
+    }
+    printf("######################### START OF %s #########################\n", hooks->title);
+    printStart(process_list); // print the beginning of process list
+    if(instrument)
+    {
+        traceBeginPolicy(hooks->traceName, process_list);
+    }
+    resetRandomStreams(process_list); // every policy sees the same bursts
+    for(; i < TOTAL_CREATED_PROCESSES; i++) // set all the values to their base value
+    {
+        process_list[i].status = 0;
+        process_list[i].finishingTime = 0;
+        process_list[i].currentCPUTimeRun = 0;
+        process_list[i].currentIOBlockedTime = 0;
+        process_list[i].currentWaitingTime = 0;
+        process_list[i].quantum = 0;
+        process_list[i].contendedCPUTime = 0;
+        process_list[i].orginialC = process_list[i].C;
+        process_list[i].CPUBurst = nextCPUBurst(&process_list[i]);
+        process_list[i].IOBurst = currentIOBurst(&process_list[i]);
+        process_list[i].finished = false;
+    }
+    tickArraysGather(&TICK); // from here on the state of the processes is kept in TICK
+    hooks->start(process_list);
+    if(memory_model)
+    {
+        memoryStart(process_list);
+    }
+    while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) // like the other policies: the processes run this cycle as they were dispatched last cycle
+    {
+        if(print_cycles)
+        {
+            printf(" Before cycle: %d", CURRENT_CYCLE);
+            for(i = 0; i < TOTAL_CREATED_PROCESSES; i++)
+            {
+                printf(" %s  %d ", status_names[TICK.status[i]], TICK.status[i]);
+            }
+            printf("\n");
+        }
+        if(instrument)
+        {
+            for(i = 0; i < TOTAL_CREATED_PROCESSES; i++)
+            {
+                traceObserve(&process_list[i], TICK.status[i]);
+            }
+        }
+
+        tickKernelRun(&TICK, TICK_KERNEL); // ready and blocked bookkeeping of every process at once
+        if(memory_model)
+        {
+            memoryTick();
+        }
+        if(running != NULL) // then the running one
+        {
+            running->currentCPUTimeRun++;
+            running->orginialC--;
+            running->CPUBurst--;
+            running->quantum++;
+            if(TOTAL_FINISHED_PROCESSES == 0)
+            {
+                running->contendedCPUTime++;
+            }
+            hooks->ran(running);
+            if(running->orginialC == 0) // no CPU time left so it terminates
+            {
+                TICK.status[tickLane(running)] = 4;
+                running->finished = true;
+                running->finishingTime = CURRENT_CYCLE;
+                TOTAL_FINISHED_PROCESSES++;
+                if(memory_model)
+                {
+                    memoryRelease(running);
+                }
+                running = NULL;
+            }
+            else if(running->CPUBurst == 0 && TICK.ioBurst[tickLane(running)] == 0) // burst done and no IO to do (M is 0) so it's ready again
+            {
+                TICK.status[tickLane(running)] = 1;
+                running->quantum = 0;
+                running->CPUBurst = nextCPUBurst(running);
+                TICK.ioBurst[tickLane(running)] = currentIOBurst(running);
+                hooks->ready(running);
+                running = NULL;
+            }
+            else if(running->CPUBurst == 0) // burst done so it does its IO
+            {
+                TICK.status[tickLane(running)] = 3;
+                running->quantum = 0;
+                running = NULL;
+            }
+        }
+
+        for(i = arrived, arrived = admitArrivals(process_list, arrived); i < arrived; i++) // processes arriving this cycle are ready (if they fit in memory)
+        {
+            if(process_list[i].orginialC == 0) // no CPU time to run so it terminates right away
+            {
+                TICK.status[i] = 4;
+                process_list[i].finished = true;
+                process_list[i].finishingTime = CURRENT_CYCLE;
+                TOTAL_FINISHED_PROCESSES++;
+            }
+            else if(!memory_model || memoryAdmit(&process_list[i]))
+            {
+                TICK.status[i] = 1;
+                hooks->ready(&process_list[i]);
+            }
+        }
+        for(uint32_t word = 0; word <= TICK.capacity / 64; word++) // processes that finished their IO this cycle are ready with a new CPU burst
+        {
+            uint64_t done = TICK.ioDoneMask[word];
+            for(; done != 0; done &= done - 1)
+            {
+                uint32_t lane = word * 64 + __builtin_ctzll(done);
+                _process *process = &process_list[lane];
+                process->CPUBurst = nextCPUBurst(process);
+                TICK.ioBurst[lane] = currentIOBurst(process);
+                if(memory_model && process->swappedOut) // it has to be swapped back in first
+                {
+                    memorySuspend(process);
+                    continue;
+                }
+                TICK.status[lane] = 1;
+                hooks->ready(process);
+            }
+        }
+        if(memory_model)
+        {
+            memoryCycle(process_list, hooks);
+        }
+        if(running != NULL && hooks->preempt(running)) // the policy can take the CPU back now that this cycle's processes are ready
+        {
+            TICK.status[tickLane(running)] = 1;
+            hooks->ready(running);
+            running = NULL;
+        }
+        if(running == NULL) // the CPU is free so the policy picks who runs next cycle
+        {
+            running = hooks->pick();
+            if(running != NULL)
+            {
+                TICK.status[tickLane(running)] = 2;
+                running->quantum = 0;
+            }
+            else if(memory_model && READY_SUSPENDED_COUNT > 0) // the CPU is idle because of the memory
+            {
+                TOTAL_STALL_CYCLES++;
+            }
+        }
+        CURRENT_CYCLE++;
+    }
+    tickArraysScatter(&TICK);
+    for(i = 0; i < TOTAL_CREATED_PROCESSES; i++) // we also add the blocked time to number of cycles spent blocked
+    {
+        TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED += process_list[i].currentIOBlockedTime;
+    }
+    tickArraysFree(&TICK);
+    if(instrument)
+    {
+        traceEndPolicy(process_list);
+    }
+    printProcessSpecifics(process_list); // print final specifics and summary
+    printSummaryData(process_list);
+    if(memory_model)
+    {
+        printMemoryData();
+        SHOW_SUSPENDED_TIME = false;
+    }
+    hooks->end(process_list);
+    printFinal(process_list);
+    printf("######################### END OF %s #########################\n", hooks->title);
+}
+
+/**
+ * The generic engine: hooks called through pointers and every option checked at run time
+ */
+__attribute__((noinline)) void simulateWithHooks(_process* process_list, const _policy_hooks *hooks)
+{
+    simulateEngine(process_list, hooks, PRINT_CYCLES, TRACE != NULL, MEMORY_CAPACITY > 0);
+}
+
+
+/********************* STRIDE / LOTTERY SCHEDULING *********************/
+
+
+#define STRIDE_ONE MAX_TICKETS          // Stride of a process with a single ticket, a process with MAX_TICKETS has a stride of 1
+#define STRIDE_QUANTUM 2                // Default cycles a process runs before the next one is picked (same as Round Robin)
+
+uint32_t STRIDE_QUANTUM_CYCLES = STRIDE_QUANTUM; // The quantum of stride and lottery (--quantum=N)
+
+uint64_t GLOBAL_PASS = 0;               // The pass of the last dispatched process, a process coming back never starts behind it
+uint64_t LOTTERY_DRAWS = 0;             // The number of lottery draws so far, each draw is counter-based random number
+
+void strideStart(_process process_list[])
+{
+    uint32_t i = 0;
+    GLOBAL_PASS = 0;
+    LOTTERY_DRAWS = 0;
+    SHOW_CPU_SHARE = true;
+    for(; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        process_list[i].stride = STRIDE_ONE / process_list[i].tickets;
+        process_list[i].pass = process_list[i].stride;
+    }
+}
+
+void strideReady(_process *process)
+{
+    if(process->pass < GLOBAL_PASS) // it doesn't get to catch up on the time it wasn't ready
+    {
+        process->pass = GLOBAL_PASS;
+    }
+    heapPush(process, process->pass);
+}
+
+_process *stridePick()
+{
+    _process *process = heapPop();
+    if(process != NULL)
+    {
+        GLOBAL_PASS = process->pass;
+    }
+    return process;
+}
+
+void strideRan(_process *process)
+{
+    process->pass += process->stride;
+}
+
+bool stridePreempt(_process *process)
+{
+    return process->quantum >= STRIDE_QUANTUM;
+}
+
+/**
+ * Same as stridePreempt with the quantum set on the command line
+ */
+bool stridePreemptConfigured(_process *process)
+{
+    return process->quantum >= STRIDE_QUANTUM_CYCLES;
+}
+
+void strideEnd(_process process_list[])
+{
+    SHOW_CPU_SHARE = false;
+}
+
+/**
+ * Lottery: the winner is drawn at random with a chance proportional to its tickets, O(N) per draw
+ */
+_process *lotteryPick()
+{
+    uint64_t total_tickets = 0;
+    uint64_t winner;
+    uint32_t i = 0;
+    if(READY_HEAP.size == 0)
+    {
+        return NULL;
+    }
+    for(; i < READY_HEAP.size; i++)
+    {
+        total_tickets += READY_HEAP.processes[i]->tickets;
+    }
+    winner = counterRandomMix(RANDOM_COUNTER_SEED ^ counterRandomMix(++LOTTERY_DRAWS)) % total_tickets;
+    for(i = 0; winner >= READY_HEAP.processes[i]->tickets; i++)
+    {
+        winner -= READY_HEAP.processes[i]->tickets;
+    }
+    return heapRemoveAt(i);
+}
+
+void lotteryReady(_process *process)
+{
+    heapPush(process, 0);
+}
+
+const _policy_hooks STRIDE_HOOKS = {"STRIDE SCHEDULING", "Stride", strideStart, strideReady, stridePick, strideRan, stridePreempt, strideEnd};
+const _policy_hooks LOTTERY_HOOKS = {"LOTTERY SCHEDULING", "Lottery", strideStart, lotteryReady, lotteryPick, strideRan, stridePreempt, strideEnd};
+const _policy_hooks STRIDE_CONFIGURED_HOOKS = {"STRIDE SCHEDULING", "Stride", strideStart, strideReady, stridePick, strideRan, stridePreemptConfigured, strideEnd};
+const _policy_hooks LOTTERY_CONFIGURED_HOOKS = {"LOTTERY SCHEDULING", "Lottery", strideStart, lotteryReady, lotteryPick, strideRan, stridePreemptConfigured, strideEnd};
+
+
+/********************* EARLIEST DEADLINE FIRST *********************/
+
+
+/**
+ * Returns the absolute deadline of a process (arrival + deadline), processes without one come last
+ */
+static inline uint64_t absoluteDeadline(const _process *process)
+{
+    return process->deadline > 0 ? (uint64_t) process->A + process->deadline : UINT64_MAX;
+}
+
+void edfStart(_process process_list[])
+{
+}
+
+void edfReady(_process *process)
+{
+    heapPush(process, absoluteDeadline(process));
+}
+
+/**
+ * The running process is pre-empted as soon as a ready one has an earlier deadline
+ */
+bool edfPreempt(_process *process)
+{
+    return READY_HEAP.size > 0 && READY_HEAP.keys[0] < absoluteDeadline(process);
+}
+
+void edfRan(_process *process)
+{
+}
+
+/**
+ * Prints the deadline misses and how late the processes finished, next to the summary data.
+ * A process meets its deadline when its last cycle of CPU time is at most cycle A + deadline (it runs at the earliest in cycle A + 1).
+ */
+void edfEnd(_process process_list[])
+{
+    static const char *bucket_names[] = {"on time", "1-9 cycles", "10-99 cycles", "100-999 cycles", "1000+ cycles"};
+    uint32_t buckets[5] = {0};
+    uint32_t with_deadline = 0;
+    uint32_t missed = 0;
+    int64_t max_lateness = INT64_MIN;
+    double total_lateness = 0.0;
+    uint32_t i = 0;
+    for(; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        int64_t lateness;
+        if(process_list[i].deadline == 0)
+        {
+            continue;
+        }
+        lateness = (int64_t) process_list[i].finishingTime - (int64_t) absoluteDeadline(&process_list[i]);
+        with_deadline++;
+        total_lateness += lateness;
+        if(lateness > max_lateness)
+        {
+            max_lateness = lateness;
+        }
+        if(lateness <= 0)
+        {
+            buckets[0]++;
+            continue;
+        }
+        missed++;
+        buckets[lateness < 10 ? 1 : lateness < 100 ? 2 : lateness < 1000 ? 3 : 4]++;
+    }
+    printf("Deadline Data:\n");
+    printf("\tDeadlines missed: %u of %u\n", missed, with_deadline);
+    if(with_deadline == 0)
+    {
+        return;
+    }
+    printf("\tAverage lateness: %6f\n", total_lateness / with_deadline);
+    printf("\tMaximum lateness: %lld\n", (long long) max_lateness);
+    printf("\tLateness distribution:");
+    for(i = 0; i < 5; i++)
+    {
+        printf(" %s %u%s", bucket_names[i], buckets[i], i < 4 ? "," : "\n");
+    }
+}
+
+const _policy_hooks EDF_HOOKS = {"EARLIEST DEADLINE FIRST", "Earliest Deadline First", edfStart, edfReady, heapPop, edfRan, edfPreempt, edfEnd};
+
+/**
+ * Admission check: could every deadline be met, looking at CPU time only (IO is ignored, so this is optimistic).
+ * For every window from an arrival to a deadline, the CPU time of the processes that arrive and are due inside
+ * it must fit in it (processor demand criterion). Prints the result, returns true when the workload is feasible.
+ */
+bool checkDeadlineFeasibility(_process process_list[])
+{
+    uint32_t i = 0;
+    for(; i < TOTAL_CREATED_PROCESSES; i++) // window start: an arrival time
+    {
+        for(uint32_t j = 0; j < TOTAL_CREATED_PROCESSES; j++) // window end: a deadline
+        {
+            uint64_t window_start = process_list[i].A;
+            uint64_t window_end = absoluteDeadline(&process_list[j]);
+            uint64_t demand = 0;
+            if(process_list[j].deadline == 0 || window_end <= window_start)
+            {
+                continue;
+            }
+            for(uint32_t k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+            {
+                if(process_list[k].deadline > 0 && process_list[k].A >= window_start && absoluteDeadline(&process_list[k]) <= window_end)
+                {
+                    demand += process_list[k].C;
+                }
+            }
+            if(demand > window_end - window_start)
+            {
+                printf("Admission check: infeasible, processes arriving at or after cycle %llu and due by cycle %llu need %llu cycles of CPU time\n",
+                       (unsigned long long) window_start, (unsigned long long) window_end, (unsigned long long) demand);
+                return false;
+            }
+        }
+    }
+    printf("Admission check: feasible (CPU time only, IO is not taken into account)\n");
+    return true;
+}
+
+
+/********************* COMPLETELY FAIR SCHEDULING *********************/
+
+
+#define CFS_NICE_0_WEIGHT 1024          // Weight of a nice 0 process, its vruntime advances 1024 per cycle run
+
+/* Linux' nice to weight table (sched_prio_to_weight), each nice level is about 10% CPU */
+const uint32_t CFS_NICE_WEIGHTS[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+    9548, 7620, 6100, 4904, 3906,
+    3121, 2501, 1991, 1586, 1277,
+    1024, 820, 655, 526, 423,
+    335, 272, 215, 172, 137,
+    110, 87, 70, 56, 45,
+    36, 29, 23, 18, 15,
+};
+
+uint32_t CFS_TARGET_LATENCY = 6;        // Cycles in which every runnable process should run once (--cfs-latency=N)
+uint32_t CFS_MIN_GRANULARITY = 1;       // A process always runs at least this many cycles (--cfs-min-granularity=N)
+uint64_t CFS_MIN_VRUNTIME = 0;          // Never decreasing minimum vruntime, where new and waking processes are placed
+uint64_t CFS_READY_WEIGHT = 0;          // The total weight of the processes in the ready heap
+
+void cfsStart(_process process_list[])
+{
+    uint32_t i = 0;
+    CFS_MIN_VRUNTIME = 0;
+    CFS_READY_WEIGHT = 0;
+    for(; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        process_list[i].weight = CFS_NICE_WEIGHTS[process_list[i].nice + 20];
+        process_list[i].vruntime = 0;
+        process_list[i].timeslice = 0;
+    }
+}
+
+/**
+ * Places a ready process in the tree: processes coming back from IO get at most half a target latency of credit
+ * for the time they were away, so sleepers can't starve the others
+ */
+void cfsReady(_process *process)
+{
+    uint64_t sleeper_credit = (uint64_t) CFS_TARGET_LATENCY * CFS_NICE_0_WEIGHT / 2;
+    uint64_t earliest = CFS_MIN_VRUNTIME > sleeper_credit ? CFS_MIN_VRUNTIME - sleeper_credit : 0;
+    if(process->quantum == 0 && process->vruntime < earliest) // arrived or woke up (not pre-empted)
+    {
+        process->vruntime = earliest;
+    }
+    CFS_READY_WEIGHT += process->weight;
+    heapPush(process, process->vruntime);
+}
+
+/**
+ * Runs the lowest vruntime next for its share of the target latency (at least the minimum granularity)
+ */
+_process *cfsPick()
+{
+    _process *process = heapPop();
+    if(process == NULL)
+    {
+        return NULL;
+    }
+    CFS_READY_WEIGHT -= process->weight;
+    process->timeslice = (uint32_t) ((uint64_t) CFS_TARGET_LATENCY * process->weight / (CFS_READY_WEIGHT + process->weight));
+    if(process->timeslice < CFS_MIN_GRANULARITY)
+    {
+        process->timeslice = CFS_MIN_GRANULARITY;
+    }
+    if(process->vruntime > CFS_MIN_VRUNTIME)
+    {
+        CFS_MIN_VRUNTIME = process->vruntime;
+    }
+    return process;
+}
+
+/**
+ * The vruntime advances slower the heavier the process is
+ */
+void cfsRan(_process *process)
+{
+    process->vruntime += (uint64_t) CFS_NICE_0_WEIGHT * CFS_NICE_0_WEIGHT / process->weight;
+}
+
+/**
+ * Pre-empted once the slice is used up and a ready process is further behind
+ */
+bool cfsPreempt(_process *process)
+{
+    return process->quantum >= process->timeslice && READY_HEAP.size > 0 && READY_HEAP.keys[0] < process->vruntime;
+}
+
+/**
+ * Prints Jain's fairness index of the CPU share each process got while all of them were competing, relative to the
+ * share its weight entitled it to. Only processes that were runnable before the first termination count:
+ * 1 is perfectly fair, 1/n is one process getting everything
+ */
+void cfsEnd(_process process_list[])
+{
+    double weight[MAX_PROCESSES] = {0};
+    double target_share[MAX_PROCESSES];
+    double total_cpu_time = 0.0;
+    double sum = 0.0;
+    double sum_of_squares = 0.0;
+    uint32_t competing = 0;
+    uint32_t i = 0;
+    for(; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        weight[i] = process_list[i].weight;
+        total_cpu_time += process_list[i].contendedCPUTime;
+    }
+    contendedTargetShares(process_list, weight, target_share);
+    for(i = 0; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        if(target_share[i] > 0) // it arrived before the first termination
+        {
+            double share = total_cpu_time > 0 ? process_list[i].contendedCPUTime / total_cpu_time / target_share[i] : 0.0;
+            sum += share;
+            sum_of_squares += share * share;
+            competing++;
+        }
+    }
+    printf("Fairness Data:\n");
+    printf("\tJain fairness index: %6f\n", sum_of_squares > 0 ? sum * sum / (competing * sum_of_squares) : 1.0);
+}
+
+const _policy_hooks CFS_HOOKS = {"COMPLETELY FAIR SCHEDULER", "Completely Fair Scheduler", cfsStart, cfsReady, cfsPick, cfsRan, cfsPreempt, cfsEnd};
+
+
+/********************* SPECIALISED ENGINES *********************/
+
+
+typedef void (*_policy_function)(_process* process_list);
+
+/* The engines, one per set of hooks */
+typedef enum {ENGINE_STRIDE, ENGINE_STRIDE_CONFIGURED, ENGINE_LOTTERY, ENGINE_LOTTERY_CONFIGURED, ENGINE_EDF, ENGINE_CFS, TOTAL_ENGINES} _engine;
+
+const _policy_hooks *ENGINE_HOOKS[TOTAL_ENGINES] = {
+    &STRIDE_HOOKS, &STRIDE_CONFIGURED_HOOKS, &LOTTERY_HOOKS, &LOTTERY_CONFIGURED_HOOKS, &EDF_HOOKS, &CFS_HOOKS,
+};
+
+bool GENERIC_ENGINE = false;            // Use the generic engine instead of the specialised ones (--engine=generic)
+
+/* One engine per (hooks, cycle printing, timeline export): the hooks get inlined and the per-process printing and
+ * tracing compiled out when they're off. The memory model and the tick kernel stay run-time checks, once per cycle */
+#define DEFINE_ENGINE(name, hooks, print_cycles, instrument) \
+    void simulate_##name##_##print_cycles##instrument(_process* process_list) \
+    { \
+        simulateEngine(process_list, &hooks, print_cycles, instrument, MEMORY_CAPACITY > 0); \
+    }
+#define DEFINE_ENGINES(name, hooks) \
+    DEFINE_ENGINE(name, hooks, 0, 0) DEFINE_ENGINE(name, hooks, 0, 1) \
+    DEFINE_ENGINE(name, hooks, 1, 0) DEFINE_ENGINE(name, hooks, 1, 1)
+#define ENGINE_TABLE_ROW(name) {{simulate_##name##_00, simulate_##name##_01}, {simulate_##name##_10, simulate_##name##_11}}
+
+DEFINE_ENGINES(stride, STRIDE_HOOKS)
+DEFINE_ENGINES(strideConfigured, STRIDE_CONFIGURED_HOOKS)
+DEFINE_ENGINES(lottery, LOTTERY_HOOKS)
+DEFINE_ENGINES(lotteryConfigured, LOTTERY_CONFIGURED_HOOKS)
+DEFINE_ENGINES(edf, EDF_HOOKS)
+DEFINE_ENGINES(cfs, CFS_HOOKS)
+
+/* Indexed by [engine][cycle printing][timeline export] */
+const _policy_function SPECIALISED_ENGINES[TOTAL_ENGINES][2][2] = {
+    ENGINE_TABLE_ROW(stride),
+    ENGINE_TABLE_ROW(strideConfigured),
+    ENGINE_TABLE_ROW(lottery),
+    ENGINE_TABLE_ROW(lotteryConfigured),
+    ENGINE_TABLE_ROW(edf),
+    ENGINE_TABLE_ROW(cfs),
+};
+
+/**
+ * Runs an engine: the specialised one matching the current options, or the generic one
+ */
+void simulateDispatch(_process* process_list, _engine engine)
+{
+    if(GENERIC_ENGINE)
+    {
+        simulateWithHooks(process_list, ENGINE_HOOKS[engine]);
+        return;
+    }
+    SPECIALISED_ENGINES[engine][PRINT_CYCLES][TRACE != NULL](process_list);
+}
+
+/* FCFS, RR and SJF the same way per (cycle printing, timeline export). They have no hooks, so there is no generic version of them */
+#define DEFINE_POLICY(name, print_cycles, instrument) \
+    void simulate##name##_##print_cycles##instrument(_process* process_list) \
+    { \
+        simulate##name##Cycles(process_list, print_cycles, instrument); \
+    }
+#define DEFINE_POLICIES(name) \
+    DEFINE_POLICY(name, 0, 0) DEFINE_POLICY(name, 0, 1) DEFINE_POLICY(name, 1, 0) DEFINE_POLICY(name, 1, 1) \
+    const _policy_function name##_POLICIES[2][2] = {{simulate##name##_00, simulate##name##_01}, {simulate##name##_10, simulate##name##_11}}; \
+    void simulate##name(_process* process_list) \
+    { \
+        name##_POLICIES[PRINT_CYCLES][TRACE != NULL](process_list); \
+    }
+
+/* Each is indexed by [cycle printing][timeline export] */
+DEFINE_POLICIES(FCFS)
+DEFINE_POLICIES(RR)
+DEFINE_POLICIES(SJF)
+
+void simulateStride(_process* process_list)
+{
+    simulateDispatch(process_list, STRIDE_QUANTUM_CYCLES == STRIDE_QUANTUM ? ENGINE_STRIDE : ENGINE_STRIDE_CONFIGURED);
+}
+
+void simulateLottery(_process* process_list)
+{
+    simulateDispatch(process_list, STRIDE_QUANTUM_CYCLES == STRIDE_QUANTUM ? ENGINE_LOTTERY : ENGINE_LOTTERY_CONFIGURED);
+}
+
+void simulateEDF(_process* process_list)
+{
+    simulateDispatch(process_list, ENGINE_EDF);
+}
+
+void simulateCFS(_process* process_list)
+{
+    simulateDispatch(process_list, ENGINE_CFS);
+}
+
+
+/********************* SIMULATION SERVICE *********************/
+
+
+#define SERVICE_MAX_FRAME (1 << 20)     // Largest frame the service accepts (a workload submission)
+
+/* A policy that can be requested by name */
+typedef struct Policy {
+    const char *name;                   // The name used in submissions
+    _policy_function simulate;          // The simulate function of the policy
+    bool memoryModel;                   // It runs on the shared engine, so --memory applies to it
+} _policy;
+
+const _policy POLICIES[] = {
+    {"fcfs", simulateFCFS, false},
+    {"rr", simulateRR, false},
+    {"sjf", simulateSJF, false},
+    {"stride", simulateStride, true},
+    {"lottery", simulateLottery, true},
+    {"edf", simulateEDF, true},
+    {"cfs", simulateCFS, true},
+};
+const uint32_t TOTAL_POLICIES = sizeof(POLICIES) / sizeof(POLICIES[0]);
+
+/**
+ * Returns the policy with the given name, NULL if there is none
+ */
+const _policy *findPolicy(const char *name)
+{
+    uint32_t p = 0;
+    for(; p < TOTAL_POLICIES; p++)
+    {
+        if(strcmp(name, POLICIES[p].name) == 0)
+        {
+            return &POLICIES[p];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Writes exactly length bytes to fd, returns 0 on success and 1 on failure
+ */
+int writeAll(int fd, const void *data, size_t length)
+{
+    const char *bytes = data;
+    while(length > 0)
+    {
+        ssize_t written = write(fd, bytes, length);
+        if(written <= 0)
+        {
+            return 1;
+        }
+        bytes += written;
+        length -= written;
+    }
+    return 0;
+}
+
+/**
+ * Reads exactly length bytes from fd, returns 0 on success and 1 on failure or end of file
+ */
+int readAll(int fd, void *data, size_t length)
+{
+    char *bytes = data;
+    while(length > 0)
+    {
+        ssize_t got = read(fd, bytes, length);
+        if(got <= 0)
+        {
+            return 1;
+        }
+        bytes += got;
+        length -= got;
+    }
+    return 0;
+}
+
+/**
+ * Sends one frame: a 4 byte big endian length followed by the payload
+ */
+int sendFrame(int fd, const char *payload, uint32_t length)
+{
+    uint32_t network_length = htonl(length);
+    return writeAll(fd, &network_length, sizeof(network_length)) || writeAll(fd, payload, length);
+}
+
+/**
+ * Receives one frame, the payload is returned NUL terminated (caller frees it), NULL on failure
+ */
+char *receiveFrame(int fd, uint32_t *length)
+{
+    uint32_t network_length;
+    char *payload;
+    if(readAll(fd, &network_length, sizeof(network_length)))
+    {
+        return NULL;
+    }
+    *length = ntohl(network_length);
+    if(*length > SERVICE_MAX_FRAME)
+    {
+        return NULL;
+    }
+    payload = malloc(*length + 1);
+    if(payload == NULL || readAll(fd, payload, *length))
+    {
+        free(payload);
+        return NULL;
+    }
+    payload[*length] = '\0';
+    return payload;
+}
 
-                    }
-                    else
-                    {
-                        process_list[i].status = 2;
-                        process_list[i].IOBurst = process_list[i].CPUBurst * process_list[i].M;
-                        runner = 1;
-                        process_list[i].nextInReadyQueue = NULL;
-                    }
-                }
-                else if(runner == 1 && process_list[i].status == 1) // if theres a runner and the process is ready then we check if the process before is running
-                {
-                    if(process_list[i - 1].status == 2)
-                    {
-                        process_list[i].nextInReadyQueue = &process_list[i];
-                    }
-                }
-                else if(process_list[i].nextInReadySuspendedQueue != NULL && process_list[i].IOBurst == 0) // when process was in suspened queue then we make can take to the ready to be up next to run
-                {
-                    process_list[i].status = 1;
-                    process_list[i].nextInReadySuspendedQueue = NULL;
-                    process_list[i].nextInReadyQueue = &process_list[i];
-                }
-                if(process_list[i].orginialC == 0 && process_list[i].finished == false) // if the cpu completion time hits 0 and it wasn't finished already then we termiate it
-                {
-                    process_list[i].status = 4;
-                    process_list[i].finished = true;
-                    process_list[i].finishingTime = CURRENT_CYCLE;
-                    TOTAL_FINISHED_PROCESSES++;
+/* What a connection asks a worker to simulate, followed by the processes (a _process array, they share the binary) */
+typedef struct WorkerJob {
+    uint32_t policy;                    // The index of the policy in POLICIES
+    uint32_t processes;                 // The number of processes that follow
+    _random_mode randomMode;            // The options of the submission
+    uint64_t randomCounterSeed;
+} _worker_job;
+
+/* A job waiting for (or being simulated by) the worker of its policy */
+typedef struct QueuedJob {
+    uint64_t connection;                // The id of the connection that submitted it, its result is dropped if that closed
+    _worker_job job;
+    _process *processes;                // A copy of the submitted processes
+    struct QueuedJob *next;
+} _queued_job;
+
+/* A worker process kept warm for one policy for as long as the service runs */
+typedef struct Worker {
+    pid_t pid;                          // 0 while the worker isn't running
+    int jobPipe;                        // Jobs are written to the worker here
+    int resultPipe;                     // And their summaries come back here, one frame per job
+    _queued_job *head;                  // The jobs of the policy in submission order, the first one is being simulated when busy
+    _queued_job *tail;
+    bool busy;
+} _worker;
+
+#define SERVICE_MAX_CONNECTIONS 16      // Connections served at once, the others wait to be accepted
+#define SERVICE_TIMEOUT 5               // Seconds a connection may take to send a frame or to take its results
+
+/* A client connection of the service */
+typedef struct Connection {
+    int fd;                             // -1 while the slot is free
+    uint64_t id;                        // Never reused, so late results of a closed connection aren't sent to the next one
+    uint32_t pending;                   // Results of its submission still to come, it isn't read from until they are sent
+} _connection;
 
-                }
-                if(process_list[i].quantum == 0 && process_list[i].orginialC != 0) // check if the quantum is 0 then we stop running 
-                {
-                    process_list[i].quantum = 2;
-                    process_list[i].status = 1;
-                    process_list[i].nextInReadyQueue = &process_list[i];
-                }
-            }
-            else // if arrival time isn't 0 then we -- till it's 0 because right now its unstarted
-            {
-                process_list[i].orginialA--;
-            }
-            i++;
+/**
+ * The loop of a worker: simulates every job with the cycle by cycle output turned off and answers with the summary.
+ * Exits when the service closes the job pipe.
+ */
+void workerLoop(int job_fd, int result_fd)
+{
+    _worker_job job;
+    _process *process_list = malloc(MAX_PROCESSES * sizeof(_process));
+    PRINT_CYCLES = false;
+    if(process_list == NULL || freopen("/dev/null", "w", stdout) == NULL) // everything but the summary is dropped
+    {
+        _exit(1);
+    }
+    while(readAll(job_fd, &job, sizeof(job)) == 0)
+    {
+        char *summary = NULL;
+        size_t length = 0;
+        FILE *summary_file;
+        if(job.policy >= TOTAL_POLICIES || job.processes > MAX_PROCESSES || readAll(job_fd, process_list, job.processes * sizeof(_process)))
+        {
+            _exit(1);
         }
-        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check to see if theres a running process at the end
+        TOTAL_CREATED_PROCESSES = job.processes;
+        RANDOM_MODE = job.randomMode;
+        RANDOM_COUNTER_SEED = job.randomCounterSeed;
+        POLICIES[job.policy].simulate(process_list);
+        fflush(stdout);
+        summary_file = open_memstream(&summary, &length);
+        if(summary_file == NULL)
         {
-            if(process_list[k].status == 2)
+            _exit(1);
+        }
+        fprintf(summary_file, "Policy: %s\n", POLICIES[job.policy].name);
+        printSummaryDataTo(summary_file, process_list);
+        fclose(summary_file);
+        if(sendFrame(result_fd, summary, (uint32_t) length))
+        {
+            _exit(1);
+        }
+        free(summary);
+    }
+    _exit(0);
+}
+
+/**
+ * Forks the worker of policy index of the pool, returns 0 on success and 1 on failure
+ */
+int startWorker(_worker pool[], uint32_t index, int listener, const _connection connections[])
+{
+    int job_pipe[2];
+    int result_pipe[2];
+    if(pipe(job_pipe))
+    {
+        return 1;
+    }
+    if(pipe(result_pipe))
+    {
+        close(job_pipe[0]);
+        close(job_pipe[1]);
+        return 1;
+    }
+    pool[index].pid = fork();
+    if(pool[index].pid < 0)
+    {
+        pool[index].pid = 0;
+        close(job_pipe[0]);
+        close(job_pipe[1]);
+        close(result_pipe[0]);
+        close(result_pipe[1]);
+        return 1;
+    }
+    if(pool[index].pid == 0) // the worker only keeps its own pipe ends, so the others see end of file when their peer goes away
+    {
+        close(listener);
+        for(uint32_t c = 0; c < SERVICE_MAX_CONNECTIONS; c++)
+        {
+            if(connections[c].fd >= 0)
             {
-                runner2 = 1;
+                close(connections[c].fd);
             }
         }
-        if(runner2 == 0) // if theres not and theres a process in the ready queue then we make that a running process
+        close(job_pipe[1]);
+        close(result_pipe[0]);
+        for(uint32_t k = 0; k < TOTAL_POLICIES; k++)
         {
-            for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+            if(k != index && pool[k].pid > 0)
             {
-                if(process_list[k].nextInReadyQueue != NULL && runner2 == 0)
-                {
-                    process_list[k].nextInReadyQueue = NULL;
-                    process_list[k].status = 2;
-                    if(process_list[k].IOBurst == 0)
-                    {
-                        process_list[k].IOBurst = process_list[k].CPUBurst * process_list[k].M;
-                    }
-                    runner2 = 1;
-                }
+                close(pool[k].jobPipe);
+                close(pool[k].resultPipe);
             }
         }
-        i = 0;
-        printf("\n");
-        j = 0;
-        CURRENT_CYCLE++; // increment cycle at the end
-        runner = 0; // and reset the variables for the next cycle
-        runner2 = 0;
+        workerLoop(job_pipe[0], result_pipe[1]);
     }
-    for(int i = 0; i < TOTAL_CREATED_PROCESSES; i++) // we also add the blocked time to number of cycles spent blocked
+    close(job_pipe[0]);
+    close(result_pipe[1]);
+    pool[index].jobPipe = job_pipe[1];
+    pool[index].resultPipe = result_pipe[0];
+    return 0;
+}
+
+/**
+ * Stops a worker (it exits once its job pipe is closed) and returns how it ended, like waitpid
+ */
+int stopWorker(_worker *worker)
+{
+    int status = 0;
+    close(worker->jobPipe);
+    close(worker->resultPipe);
+    waitpid(worker->pid, &status, 0);
+    worker->pid = 0;
+    worker->busy = false;
+    return status;
+}
+
+/**
+ * Sends the error frame of a policy whose worker failed, saying how it ended when it's known
+ */
+void sendWorkerError(int connection, const _policy *policy, int status)
+{
+    char error[128];
+    if(WIFSIGNALED(status))
     {
-        TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED += process_list[i].currentIOBlockedTime;
+        snprintf(error, sizeof(error), "error: policy %s failed (signal %d)\n", policy->name, WTERMSIG(status));
+    }
+    else if(WIFEXITED(status) && WEXITSTATUS(status) != 0)
+    {
+        snprintf(error, sizeof(error), "error: policy %s failed (exit status %d)\n", policy->name, WEXITSTATUS(status));
+    }
+    else
+    {
+        snprintf(error, sizeof(error), "error: policy %s failed\n", policy->name);
     }
+    sendFrame(connection, error, (uint32_t) strlen(error));
+}
 
-    printProcessSpecifics(process_list); // print final specifics and summary
-    printSummaryData(process_list);
-    printFinal(process_list);
-    printf("######################### END OF ROUND ROBIN #########################\n");
-    return;
+/**
+ * Closes a connection and frees its slot
+ */
+void closeConnection(_connection *connection)
+{
+    close(connection->fd);
+    connection->fd = -1;
+    connection->pending = 0;
 }
 
-void simulateSJF(_process* process_list, FILE* random_num_file_ptr) 
+/**
+ * Takes the first job off the queue of a worker and sends its result (a summary frame, or an error when result is NULL)
+ * to the connection that submitted it, followed by the empty frame once all the results of its submission are sent
+ */
+void finishJob(_worker *worker, _connection connections[], const char *result, uint32_t length, int status)
 {
-    int i = 0;
-    TOTAL_FINISHED_PROCESSES = 0;
-    TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED = 0;
-    CURRENT_CYCLE = 0;
-    int j = 0;
-    int readyCheck = 0;
-    int minRunner = 10000;
-    int saveIndex = 0;
-    int check = 0;
-    int runner = 0;
-    int runner2 = 0;
-    printf("######################### START OF SHORTEST JOB FIRST #########################\n");
-    printStart(process_list); // print the beginning of process list
-    while(j < TOTAL_CREATED_PROCESSES) // loop through all process and set all the values to their base value
+    _queued_job *job = worker->head;
+    worker->head = job->next;
+    if(worker->head == NULL)
     {
-        process_list[j].status = 0;
-        process_list[j].finishingTime = 0;
-        process_list[j].currentCPUTimeRun = 0;
-        process_list[j].currentIOBlockedTime = 0;
-        process_list[j].currentWaitingTime = 0;
-        process_list[j].orginialC = process_list[j].C;
-        process_list[j].orginialA = process_list[j].A;
-        process_list[j].CPUBurst = randomOS(process_list[j].B,0,random_num_file_ptr);
-        process_list[j].IOBurst = process_list[j].CPUBurst * process_list[j].M;
-        process_list[j].nextInBlockedList = NULL;
-        process_list[j].nextInReadyQueue = NULL;
-        process_list[j].nextInReadySuspendedQueue = NULL;
-        process_list[j].finished = false;
-        j++;
+        worker->tail = NULL;
     }
-    j = 0; // reset j back to 0
-    while(TOTAL_FINISHED_PROCESSES < TOTAL_CREATED_PROCESSES) // we loop for all processes till all of them are finished
+    for(uint32_t c = 0; c < SERVICE_MAX_CONNECTIONS; c++)
     {
-        printf(" Before cycle: %d",CURRENT_CYCLE);
-        while(i < TOTAL_CREATED_PROCESSES) // we loop through all the processes in the process list every cycle
+        if(connections[c].fd < 0 || connections[c].id != job->connection)
         {
-            if(j < TOTAL_CREATED_PROCESSES)
-            {
-                if(process_list[j].status == 0) // if status is 0 we know its unstarted
-                {
-                    printf(" unstarted ");
-                }
-                else if(process_list[j].status == 1) // if status is 1 we know its ready and we increment that process waiting time
-                {
-                    printf(" ready ");
-                    process_list[j].currentWaitingTime++;
-                }
-                else if(process_list[j].status == 2) // if status is 2 we know its running and we increment that process CPUTimeRun and we -- from the CPU burst and the original C
-                {
-                    printf(" running ");
-                    process_list[i].currentCPUTimeRun++;
-                    process_list[i].orginialC--;
-                    process_list[j].CPUBurst--;
-                }
-                else if(process_list[j].status == 3) // if status is 3 we know its blocked and we increment that process blocked time and -- the IO burst
-                {
-                    printf(" blocked ");
-                    process_list[j].currentIOBlockedTime++;
-                    process_list[j].IOBurst--;
+            continue;
+        }
+        if(result == NULL)
+        {
+            sendWorkerError(connections[c].fd, &POLICIES[job->job.policy], status);
+        }
+        else if(sendFrame(connections[c].fd, result, length))
+        {
+            closeConnection(&connections[c]); // the client went away or stopped reading
+            break;
+        }
+        if(--connections[c].pending == 0 && sendFrame(connections[c].fd, "", 0)) // end of the results of this submission
+        {
+            closeConnection(&connections[c]);
+        }
+    }
+    free(job->processes);
+    free(job);
+}
 
-                }
-                else if(process_list[j].status == 4) // if status is 4 we know its terminated
-                {
-                    printf(" terminated ");
-                }
-                printf(" %d ",process_list[j].status);
-                j++;
-            }
-            if(process_list[i].orginialA == 0) // check if the arrival time hits 0 and we can make it ready or running
+/**
+ * Hands the next queued job to an idle worker, starting the worker first if it isn't running (or died).
+ * Jobs that can't be handed over are answered with an error.
+ */
+void dispatchJob(_worker pool[], uint32_t index, int listener, _connection connections[])
+{
+    _worker *worker = &pool[index];
+    while(!worker->busy && worker->head != NULL)
+    {
+        _queued_job *job = worker->head;
+        bool started = worker->pid == 0;
+        if(started && startWorker(pool, index, listener, connections))
+        {
+            finishJob(worker, connections, NULL, 0, 0);
+            continue;
+        }
+        if(writeAll(worker->jobPipe, &job->job, sizeof(job->job))
+           || writeAll(worker->jobPipe, job->processes, job->job.processes * sizeof(_process)))
+        {
+            int status = stopWorker(worker);
+            if(started) // a new worker failing right away isn't restarted again for this job
             {
-                if(CURRENT_CYCLE == 0) // the first cycle 
-                {
-                    if(process_list[i].orginialA == 0)
-                    {
-                        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // we loop for all the processes
-                        {
-                            if(process_list[k].status == 2) // if a running process is found we make the i value process in the ready status
-                            {
-                                process_list[i].status = 1;
-                                if(runner == 0) // if this is the first process to be ready then we just put it in the ready queue
-                                {
-                                    process_list[i].nextInReadyQueue = &process_list[i];
-                                }
-                                runner = 1; // make runner 1 to keep a vlue telling us that a process is running
-                                check = 1; // check is used to make it a runner or not
-                            }
-                        }
-                        if(check == 0) // if there was no runners then we make it a run
-                        {
-                            process_list[i].status = 2;
-                        }
-                    }
-                }
-                else if(process_list[i].status == 0) // if the process is unstarted we make it ready and place it into ready queue
-                {
-                    process_list[i].status = 1;
-                    process_list[i].nextInReadyQueue = &process_list[i];
-                }
-                else if(process_list[i].status == 2 && process_list[i].CPUBurst == 0) // if process is running and CPU burst is 0 then we go to block status and generate a new CPU burst
-                {
-                    process_list[i].status = 3;
-                    process_list[i].CPUBurst = randomOS(process_list[i].B,0,random_num_file_ptr);
-                    if(process_list[i].orginialC == 0)
-                    {
-
-                    }
-                    else
-                    {
-                        process_list[i].nextInReadySuspendedQueue = &process_list[i];
-                    }
-                }
-                else if(process_list[i].nextInReadyQueue != NULL && process_list[i].status != 4) // we the process is in ready queue
-                {
-                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check if theres process running
-                    {
-                        if(process_list[k].status == 2)
-                        {
-                            runner = 1;
-                        }
-                    }
-                    if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status == 2 && process_list[i].IOBurst == 0)
-                    { // if we are at the first process and the last process is running and its IO burst is 0 then we make the first process running
-                        process_list[i].status = 2;
-                        process_list[i].IOBurst = process_list[i].CPUBurst * process_list[i].M; // generate a new IO burst
-                        runner = 1;
-                        process_list[i].nextInReadyQueue = NULL;
-                    }
-                    else if(i == 0 && process_list[TOTAL_CREATED_PROCESSES - 1].status != 2) // checks to make sure its not the else statement
-                    {
+                finishJob(worker, connections, NULL, 0, status);
+            }
+            continue; // a worker that died while it was idle is restarted
+        }
+        worker->busy = true;
+    }
+}
 
-                    }
-                    else if(runner == 1)
-                    {
+/**
+ * Reads a submission of a connection and queues one job per requested policy. Answers right away, with an error or
+ * just the empty frame, when there is nothing to simulate. Returns 1 when the connection has to be closed.
+ * A submission is a first line of options (policy names and --random=file|counter, --seed=N) followed by an input file.
+ */
+int queueSubmission(_worker pool[], _connection *connection, char *submission)
+{
+    bool requested[sizeof(POLICIES) / sizeof(POLICIES[0])] = {false};
+    char *input = strchr(submission, '\n');
+    char *option;
+    FILE *input_file;
+    _process *process_list;
 
-                    }
-                    else if(process_list[i].status == 4)
-                    {
+    if(input == NULL)
+    {
+        return sendFrame(connection->fd, "error: missing options line\n", 28) || sendFrame(connection->fd, "", 0);
+    }
+    *input++ = '\0';
+    RANDOM_MODE = RANDOM_MODE_FILE; // options only apply to their own submission
+    RANDOM_COUNTER_SEED = SEED_VALUE;
+    for(option = strtok(submission, " \t\r"); option != NULL; option = strtok(NULL, " \t\r"))
+    {
+        if(strcmp(option, "--random=file") == 0)
+        {
+            RANDOM_MODE = RANDOM_MODE_FILE;
+        }
+        else if(strcmp(option, "--random=counter") == 0)
+        {
+            RANDOM_MODE = RANDOM_MODE_COUNTER;
+        }
+        else if(strncmp(option, "--seed=", 7) == 0)
+        {
+            RANDOM_COUNTER_SEED = strtoull(option + 7, NULL, 10);
+        }
+        for(uint32_t p = 0; p < TOTAL_POLICIES; p++)
+        {
+            if(strcmp(option, POLICIES[p].name) == 0)
+            {
+                requested[p] = true;
+            }
+        }
+    }
 
-                    }
-                    else
-                    {
-                        process_list[i].status = 2;
-                        process_list[i].IOBurst = process_list[i].CPUBurst * process_list[i].M;
-                        runner = 1;
-                        process_list[i].nextInReadyQueue = NULL;
-                    }
-                }
-                else if(runner == 1 && process_list[i].status == 1 && process_list[i].status != 4) // if theres a runner and the process is ready then we check if the process before is running
-                {
-                    if(process_list[i - 1].status == 2)
-                    {
-                        process_list[i].nextInReadyQueue = &process_list[i];
-                    }
-                }
-                else if(process_list[i].nextInReadySuspendedQueue != NULL && process_list[i].IOBurst == 0 && process_list[i].status != 4) // we process was in suspened queue then we make can take to the ready to be up next to run
-                {
-                    process_list[i].status = 1;
-                    process_list[i].nextInReadySuspendedQueue = NULL;
-                    process_list[i].nextInReadyQueue = &process_list[i];
-                    for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
-                    {
-                        if(process_list[k].status == 1)
-                        {
-                            readyCheck++;
-                        }
-                    }
-                    if(readyCheck >= 2)
-                    {
-                        minRunner = process_list[i].orginialC;
-                        saveIndex = i;
-                        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
-                        {
-                            if(process_list[k].status != 4)
-                            {
-                                if(process_list[k].orginialC + 1 < minRunner)
-                                {
-                                    saveIndex = k;
-                                    minRunner = process_list[k].orginialC;
-                                }
-                            }
-                        }
-                        process_list[saveIndex].status = 2;
-                        process_list[i].IOBurst = process_list[i].CPUBurst * process_list[i].M;
-                        runner = 1;
-                        process_list[i].nextInReadyQueue = NULL;
-                    }
-                }
-                if(process_list[i].orginialC == 0 && process_list[i].finished == false) // if the cpu completion time hits 0 and it wasn't finished already then we termiate it
-                {
-                    process_list[i].status = 4;
-                    process_list[i].finished = true;
-                    process_list[i].nextInReadyQueue = NULL;
-                    process_list[i].nextInReadySuspendedQueue = NULL;
-                    process_list[i].finishingTime = CURRENT_CYCLE;
-                    TOTAL_FINISHED_PROCESSES++;
+    process_list = malloc(MAX_PROCESSES * sizeof(_process));
+    input_file = fmemopen(input, strlen(input), "r");
+    if(process_list == NULL || input_file == NULL || readProcessesFromFile(input_file, process_list))
+    {
+        free(process_list);
+        return sendFrame(connection->fd, "error: bad input\n", 17) || sendFrame(connection->fd, "", 0);
+    }
+    for(uint32_t p = 0; p < TOTAL_POLICIES; p++) // every requested policy goes to the queue of its worker
+    {
+        _queued_job *job;
+        if(!requested[p])
+        {
+            continue;
+        }
+        job = malloc(sizeof(_queued_job));
+        if(job == NULL || (job->processes = malloc(MAX_PROCESSES * sizeof(_process))) == NULL)
+        {
+            free(job);
+            sendWorkerError(connection->fd, &POLICIES[p], 0);
+            continue;
+        }
+        job->connection = connection->id;
+        job->job = (_worker_job) {p, TOTAL_CREATED_PROCESSES, RANDOM_MODE, RANDOM_COUNTER_SEED};
+        memcpy(job->processes, process_list, TOTAL_CREATED_PROCESSES * sizeof(_process));
+        job->next = NULL;
+        if(pool[p].tail == NULL)
+        {
+            pool[p].head = job;
+        }
+        else
+        {
+            pool[p].tail->next = job;
+        }
+        pool[p].tail = job;
+        connection->pending++;
+    }
+    free(process_list);
+    return connection->pending == 0 ? sendFrame(connection->fd, "", 0) : 0;
+}
 
-                }
+/**
+ * Keeps the random table and one worker process per policy warm, and serves submissions on a Unix domain socket until killed.
+ * Every frame a connection sends is a submission, answered with one frame per policy in the order they finish and an
+ * empty frame at the end. The workers are shared by all connections: each one simulates the jobs of its policy in
+ * submission order, so different policies run concurrently. A worker is forked the first time its policy is asked for,
+ * and again if it died.
+ */
+int serve(const char *socket_path)
+{
+    struct sockaddr_un address;
+    struct timeval timeout = {SERVICE_TIMEOUT, 0};
+    _worker pool[sizeof(POLICIES) / sizeof(POLICIES[0])] = {{0}};
+    _connection connections[SERVICE_MAX_CONNECTIONS];
+    uint64_t next_connection_id = 0;
+    int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listener < 0 || strlen(socket_path) >= sizeof(address.sun_path))
+    {
+        fprintf(stderr, "Error creating socket %s\n", socket_path);
+        return 1;
+    }
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, socket_path);
+    unlink(socket_path);
+    if(bind(listener, (struct sockaddr *) &address, sizeof(address)) || listen(listener, 16))
+    {
+        fprintf(stderr, "Error listening on %s\n", socket_path);
+        close(listener);
+        return 1;
+    }
+    signal(SIGPIPE, SIG_IGN); // a client or worker going away only fails the write
+    for(uint32_t c = 0; c < SERVICE_MAX_CONNECTIONS; c++)
+    {
+        connections[c].fd = -1;
+    }
+    while(true)
+    {
+        struct pollfd fds[1 + SERVICE_MAX_CONNECTIONS + sizeof(POLICIES) / sizeof(POLICIES[0])];
+        uint32_t total_fds = 1;
+        uint32_t free_slot = SERVICE_MAX_CONNECTIONS;
+        fds[0].fd = listener;
+        fds[0].events = POLLIN;
+        for(uint32_t c = 0; c < SERVICE_MAX_CONNECTIONS; c++) // connections waiting for their results aren't read from
+        {
+            fds[total_fds].fd = connections[c].fd >= 0 && connections[c].pending == 0 ? connections[c].fd : -1;
+            fds[total_fds++].events = POLLIN;
+            free_slot = connections[c].fd < 0 && free_slot == SERVICE_MAX_CONNECTIONS ? c : free_slot;
+        }
+        for(uint32_t p = 0; p < TOTAL_POLICIES; p++)
+        {
+            fds[total_fds].fd = pool[p].busy ? pool[p].resultPipe : -1;
+            fds[total_fds++].events = POLLIN;
+        }
+        if(free_slot == SERVICE_MAX_CONNECTIONS) // full, new connections wait in the backlog
+        {
+            fds[0].fd = -1;
+        }
+        if(poll(fds, total_fds, -1) < 0)
+        {
+            continue; // interrupted
+        }
 
+        for(uint32_t p = 0; p < TOTAL_POLICIES; p++) // stream the finished summaries back
+        {
+            uint32_t length;
+            char *result;
+            if(fds[1 + SERVICE_MAX_CONNECTIONS + p].fd < 0 || fds[1 + SERVICE_MAX_CONNECTIONS + p].revents == 0)
+            {
+                continue;
             }
-            else // if arrival time isn't 0 then we -- till it's 0 because right now its unstarted
+            result = receiveFrame(pool[p].resultPipe, &length);
+            pool[p].busy = false;
+            if(result == NULL || length == 0) // the worker died, an empty frame would end the submission early
             {
-                process_list[i].orginialA--;
-                
+                finishJob(&pool[p], connections, NULL, 0, stopWorker(&pool[p]));
             }
-            i++;
+            else
+            {
+                finishJob(&pool[p], connections, result, length, 0);
+            }
+            free(result);
         }
-        for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++) // check to see if theres a running process at the end
+        for(uint32_t c = 0; c < SERVICE_MAX_CONNECTIONS; c++) // read the new submissions
         {
-            if(process_list[k].status == 2)
+            uint32_t length;
+            char *submission;
+            if(fds[1 + c].fd < 0 || fds[1 + c].revents == 0)
             {
-                runner2 = 1;
+                continue;
+            }
+            submission = receiveFrame(connections[c].fd, &length);
+            if(submission == NULL || queueSubmission(pool, &connections[c], submission))
+            {
+                closeConnection(&connections[c]); // its queued jobs still run, their results are dropped
             }
+            free(submission);
         }
-        if(runner2 == 0) // if theres not and theres a process in the ready queue then we make that a running process
+        if(fds[0].fd >= 0 && fds[0].revents != 0)
         {
-            for(int k = 0; k < TOTAL_CREATED_PROCESSES; k++)
+            int connection = accept(listener, NULL, NULL);
+            if(connection >= 0)
             {
-                if(process_list[k].nextInReadyQueue != NULL && runner2 == 0)
-                {
-                    process_list[k].nextInReadyQueue = NULL;
-                    process_list[k].status = 2;
-                    process_list[k].IOBurst = process_list[k].CPUBurst * process_list[k].M;
-                    runner2 = 1;
-                }
+                // a client that stalls in the middle of a frame only holds the service up for a while
+                setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+                connections[free_slot].fd = connection;
+                connections[free_slot].id = next_connection_id++;
+                connections[free_slot].pending = 0;
             }
         }
-        i = 0;
-        printf("\n");
-        j = 0;
-        CURRENT_CYCLE++; // increment cycle at the end
-        runner = 0; // and reset the variables for the next cycle
-        readyCheck = 0;
-        minRunner = 0;
-        saveIndex = 0;
-        runner2 = 0;
+        for(uint32_t p = 0; p < TOTAL_POLICIES; p++)
+        {
+            dispatchJob(pool, p, listener, connections);
+        }
+    }
+}
+
+
+/********************* BENCHMARK *********************/
 
+
+/**
+ * Fills the process list with a synthetic workload of MAX_PROCESSES processes, used when --bench has no input file
+ */
+void generateBenchmarkWorkload(_process *process_list)
+{
+    uint32_t i = 0;
+    TOTAL_CREATED_PROCESSES = MAX_PROCESSES;
+    for(; i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        char options[] = "";
+        parseProcessOptions(&process_list[i], options); // the defaults
+        process_list[i].A = i % 50;
+        process_list[i].B = 1 + i % 7;
+        process_list[i].C = 200 + i % 100;
+        process_list[i].M = 1 + i % 3;
+        process_list[i].orginialC = process_list[i].C;
+        process_list[i].processID = i;
+        process_list[i].tickets = 50 + 25 * (i % 4);
+        process_list[i].nice = (int32_t) (i % 5) - 2;
     }
-    for(int i = 0; i < TOTAL_FINISHED_PROCESSES; i++) // we also add the blocked time to number of cycles spent blocked
+    qsort(process_list, TOTAL_CREATED_PROCESSES, sizeof(_process), compareArrival); // like an input file, in arrival order
+}
+
+/**
+ * Returns the seconds one run of an engine takes (standard output is thrown away by the caller)
+ */
+double timeEngine(_process *process_list, _engine engine)
+{
+    struct timespec start, end;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &start);
+    simulateDispatch(process_list, engine);
+    fflush(stdout);
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &end);
+    return (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+/**
+ * Times every engine, generic against specialised, with the current options (--quiet, --memory=N, ...)
+ */
+void runBenchmark(_process *process_list, uint32_t repeats)
+{
+    static const char *engine_names[] = {"stride", "stride (--quantum)", "lottery", "lottery (--quantum)", "edf", "cfs"};
+    double generic_seconds[TOTAL_ENGINES];
+    double specialised_seconds[TOTAL_ENGINES];
+    int saved_stdout;
+    uint32_t engine = 0;
+
+    fflush(stdout);
+    saved_stdout = dup(STDOUT_FILENO);
+    if(freopen("/dev/null", "w", stdout) == NULL)
     {
-        TOTAL_NUMBER_OF_CYCLES_SPENT_BLOCKED += process_list[i].currentIOBlockedTime;
+        return;
+    }
+    for(; engine < TOTAL_ENGINES; engine++) // the fastest of the runs, alternating generic and specialised so both see the same noise
+    {
+        generic_seconds[engine] = specialised_seconds[engine] = 1e9;
+        for(uint32_t r = 0; r < repeats; r++)
+        {
+            double seconds;
+            GENERIC_ENGINE = true;
+            seconds = timeEngine(process_list, engine);
+            generic_seconds[engine] = seconds < generic_seconds[engine] ? seconds : generic_seconds[engine];
+            GENERIC_ENGINE = false;
+            seconds = timeEngine(process_list, engine);
+            specialised_seconds[engine] = seconds < specialised_seconds[engine] ? seconds : specialised_seconds[engine];
+        }
+    }
+    dup2(saved_stdout, STDOUT_FILENO);
+    close(saved_stdout);
+    clearerr(stdout);
+
+    printf("Benchmark: %u processes, fastest of %u runs per engine, cycle printing %s, memory model %s\n", TOTAL_CREATED_PROCESSES, repeats,
+           PRINT_CYCLES ? "on" : "off", MEMORY_CAPACITY > 0 ? "on" : "off");
+    for(engine = 0; engine < TOTAL_ENGINES; engine++)
+    {
+        printf("\t%-20s generic %10.3f ms  specialised %10.3f ms  speedup %5.2fx\n", engine_names[engine],
+               1000 * generic_seconds[engine], 1000 * specialised_seconds[engine],
+               generic_seconds[engine] / specialised_seconds[engine]);
     }
-    printProcessSpecifics(process_list);  // print final specifics and summary
-    printSummaryData(process_list);
-    printFinal(process_list);
-    printf("######################### END OF SHORTEST JOB FIRST #########################\n");
-    return;
 }
+
+
 /**
  * The magic starts from here
  */
 
 int main(int argc, char *argv[]) 
 {
-    _process *process_list = malloc(100 * sizeof(_process));
-    FILE *random_num_file_ptr = fopen(RANDOM_NUMBER_FILE_NAME, "r");
-    char *input_file_path = argv[1];
-    FILE *input_file = fopen(input_file_path, "r");
-    readProcessesFromFile(input_file, process_list);
-    simulateFCFS(process_list, random_num_file_ptr);
+    char *input_file_path = NULL;
+    char *trace_file_path = NULL;
+    char *socket_path = NULL;
+    char *replay_file_path = NULL;
+    char default_policies[] = "fcfs,rr,sjf";
+    char *policy_names = default_policies;
+    const _policy *policies[sizeof(POLICIES) / sizeof(POLICIES[0])];
+    uint32_t total_policies = 0;
+    bool admission_check = false;
+    bool admission_check_only = false;
+    uint32_t bench_repeats = 0;
+    for(int arg = 1; arg < argc; arg++) // options come before or after the input file path
+    {
+        if(strcmp(argv[arg], "--random=file") == 0)
+        {
+            RANDOM_MODE = RANDOM_MODE_FILE;
+        }
+        else if(strcmp(argv[arg], "--random=counter") == 0)
+        {
+            RANDOM_MODE = RANDOM_MODE_COUNTER;
+        }
+        else if(strncmp(argv[arg], "--seed=", 7) == 0)
+        {
+            RANDOM_COUNTER_SEED = strtoull(argv[arg] + 7, NULL, 10);
+        }
+        else if(strncmp(argv[arg], "--trace=", 8) == 0)
+        {
+            trace_file_path = argv[arg] + 8;
+        }
+        else if(strncmp(argv[arg], "--replay=", 9) == 0)
+        {
+            RANDOM_MODE = RANDOM_MODE_REPLAY;
+            replay_file_path = argv[arg] + 9;
+        }
+        else if(strncmp(argv[arg], "--policies=", 11) == 0)
+        {
+            policy_names = argv[arg] + 11;
+        }
+        else if(strncmp(argv[arg], "--cfs-latency=", 14) == 0)
+        {
+            CFS_TARGET_LATENCY = (uint32_t) strtoul(argv[arg] + 14, NULL, 10);
+        }
+        else if(strncmp(argv[arg], "--cfs-min-granularity=", 22) == 0)
+        {
+            CFS_MIN_GRANULARITY = (uint32_t) strtoul(argv[arg] + 22, NULL, 10);
+        }
+        else if(strncmp(argv[arg], "--memory=", 9) == 0)
+        {
+            MEMORY_CAPACITY = (uint32_t) strtoul(argv[arg] + 9, NULL, 10);
+        }
+        else if(strncmp(argv[arg], "--swap-in-cost=", 15) == 0)
+        {
+            SWAP_IN_COST = (uint32_t) strtoul(argv[arg] + 15, NULL, 10);
+        }
+        else if(strncmp(argv[arg], "--swap-out-cost=", 16) == 0)
+        {
+            SWAP_OUT_COST = (uint32_t) strtoul(argv[arg] + 16, NULL, 10);
+        }
+        else if(strcmp(argv[arg], "--quiet") == 0)
+        {
+            PRINT_CYCLES = false;
+        }
+        else if(strncmp(argv[arg], "--quantum=", 10) == 0)
+        {
+            STRIDE_QUANTUM_CYCLES = (uint32_t) strtoul(argv[arg] + 10, NULL, 10);
+        }
+        else if(strcmp(argv[arg], "--engine=generic") == 0)
+        {
+            GENERIC_ENGINE = true;
+        }
+        else if(strcmp(argv[arg], "--engine=specialised") == 0)
+        {
+            GENERIC_ENGINE = false;
+        }
+        else if(strncmp(argv[arg], "--bench=", 8) == 0)
+        {
+            bench_repeats = (uint32_t) strtoul(argv[arg] + 8, NULL, 10);
+        }
+        else if(strcmp(argv[arg], "--admission-check") == 0)
+        {
+            admission_check = true;
+        }
+        else if(strcmp(argv[arg], "--admission-check-only") == 0)
+        {
+            admission_check = admission_check_only = true;
+        }
+        else if(strncmp(argv[arg], "--serve=", 8) == 0)
+        {
+            socket_path = argv[arg] + 8;
+        }
+        else
+        {
+            input_file_path = argv[arg];
+        }
+    }
+    if(input_file_path == NULL && socket_path == NULL && bench_repeats == 0)
+    {
+        fprintf(stderr, "Usage: %s [--random=file|counter] [--seed=N] [--replay=CSV] [--trace=FILE] [--policies=LIST] [--admission-check[-only]]\n"
+                        "       [--cfs-latency=N] [--cfs-min-granularity=N]\n"
+                        "       [--memory=N] [--swap-in-cost=N] [--swap-out-cost=N] [--quantum=N] [--quiet]\n"
+                        "       [--engine=generic|specialised] input-file\n", argv[0]);
+        fprintf(stderr, "       %s --serve=SOCKET\n", argv[0]);
+        fprintf(stderr, "       %s --bench=N [options] [input-file]\n", argv[0]);
+        return 1;
+    }
+    for(char *name = strtok(policy_names, ","); name != NULL; name = strtok(NULL, ","))
+    {
+        if(findPolicy(name) == NULL || total_policies == TOTAL_POLICIES)
+        {
+            fprintf(stderr, "Unknown policy %s (or too many policies)\n", name);
+            return 1;
+        }
+        policies[total_policies++] = findPolicy(name);
+        if(MEMORY_CAPACITY > 0 && !policies[total_policies - 1]->memoryModel && socket_path == NULL && bench_repeats == 0)
+        {
+            fprintf(stderr, "Warning: --memory only applies to stride, lottery, edf and cfs, %s ignores it\n", name);
+        }
+    }
 
-    simulateRR(process_list, random_num_file_ptr);
+    if(RANDOM_MODE == RANDOM_MODE_FILE || socket_path != NULL) // the counter generator doesn't need the file at all (the service keeps it for file mode submissions)
+    {
+        FILE *random_num_file_ptr = fopen(RANDOM_NUMBER_FILE_NAME, "r");
+        if(random_num_file_ptr == NULL)
+        {
+            fprintf(stderr, "Error opening %s\n", RANDOM_NUMBER_FILE_NAME);
+            return 1;
+        }
+        int table_error = loadRandomNumberTable(random_num_file_ptr);
+        fclose(random_num_file_ptr);
+        if(table_error)
+        {
+            fprintf(stderr, "Error reading %s\n", RANDOM_NUMBER_FILE_NAME);
+            return 1;
+        }
+    }
+    if(replay_file_path != NULL)
+    {
+        REPLAY_FILE = fopen(replay_file_path, "r");
+        if(REPLAY_FILE == NULL || replayIndexFile())
+        {
+            fprintf(stderr, "Error opening %s\n", replay_file_path);
+            free(RANDOM_NUMBER_TABLE);
+            return 1;
+        }
+    }
+    selectTickKernel();
+    if(socket_path != NULL)
+    {
+        return serve(socket_path);
+    }
+    if(bench_repeats > 0 && input_file_path == NULL)
+    {
+        _process *process_list = malloc(MAX_PROCESSES * sizeof(_process));
+        generateBenchmarkWorkload(process_list);
+        runBenchmark(process_list, bench_repeats);
+        free(process_list);
+        free(RANDOM_NUMBER_TABLE);
+        return 0;
+    }
 
-    simulateSJF(process_list, random_num_file_ptr);
-    fclose(random_num_file_ptr);
+    FILE *input_file = fopen(input_file_path, "r");
+    if(input_file == NULL)
+    {
+        fprintf(stderr, "Error opening %s\n", input_file_path);
+        free(RANDOM_NUMBER_TABLE);
+        return 1;
+    }
+    if(trace_file_path != NULL && traceOpen(trace_file_path))
+    {
+        fprintf(stderr, "Error opening %s\n", trace_file_path);
+        fclose(input_file);
+        free(RANDOM_NUMBER_TABLE);
+        return 1;
+    }
+    _process *process_list = malloc(MAX_PROCESSES * sizeof(_process));
+    if(readProcessesFromFile(input_file, process_list))
+    {
+        free(process_list);
+        traceClose();
+        free(RANDOM_NUMBER_TABLE);
+        return 1;
+    }
+    for(uint32_t i = 0; REPLAY_FILE != NULL && i < TOTAL_CREATED_PROCESSES; i++)
+    {
+        if(REPLAY_INDEX[process_list[i].processID].lines == 0)
+        {
+            fprintf(stderr, "Warning: %s has no bursts for process %u, all its bursts are 1\n", replay_file_path, process_list[i].processID);
+        }
+    }
+    if(bench_repeats > 0)
+    {
+        runBenchmark(process_list, bench_repeats);
+        free(process_list);
+        traceClose();
+        free(RANDOM_NUMBER_TABLE);
+        return 0;
+    }
+    if(admission_check) // report whether the deadlines can be met before simulating
+    {
+        bool feasible = checkDeadlineFeasibility(process_list);
+        if(admission_check_only)
+        {
+            free(process_list);
+            traceClose();
+            free(RANDOM_NUMBER_TABLE);
+            return feasible ? 0 : 2;
+        }
+    }
+    for(uint32_t p = 0; p < total_policies; p++)
+    {
+        policies[p]->simulate(process_list);
+    }
 
     if(process_list != NULL)
     {
         free(process_list);
     }
+    traceClose();
+    if(REPLAY_FILE != NULL)
+    {
+        fclose(REPLAY_FILE);
+    }
+    free(RANDOM_NUMBER_TABLE);
     return 0;
 }